@@ -1,6 +1,7 @@
 from datetime import datetime
 import functools
 import logging
+import os
 import socket
 import threading
 import time
@@ -11,8 +12,9 @@ from google.protobuf import message  # noqa
 
 from esphome import const
 import esphome.api.api_pb2 as pb
+from esphome.binary_log import BinaryLogDecoder, FirmwareImage
 from esphome.const import CONF_PASSWORD, CONF_PORT
-from esphome.core import EsphomeError
+from esphome.core import CORE, EsphomeError
 from esphome.helpers import resolve_ip_address, indent, color
 from esphome.util import safe_print
 
@@ -57,10 +59,12 @@ MESSAGE_TYPE_TO_PROTO = {
     31: pb.FanCommandRequest,
     32: pb.LightCommandRequest,
     33: pb.SwitchCommandRequest,
-    34: pb.SubscribeServiceCallsRequest,
-    35: pb.ServiceCallResponse,
+    34: pb.SubscribeHomeassistantServicesRequest,
+    35: pb.HomeassistantServiceResponse,
     36: pb.GetTimeRequest,
     37: pb.GetTimeResponse,
+    51: pb.SubscribeBinaryLogsRequest,
+    52: pb.BinaryLogResponse,
 }
 
 
@@ -334,6 +338,18 @@ class APIClient(threading.Thread):
         req.level = log_level
         self._send_message(req)
 
+    def subscribe_binary_logs(self, on_log, log_level=7, dump_config=False):
+        self._check_authenticated()
+
+        def on_msg(msg):
+            if isinstance(msg, pb.BinaryLogResponse):
+                on_log(msg)
+
+        self._message_handlers.append(on_msg)
+        req = pb.SubscribeBinaryLogsRequest(dump_config=dump_config)
+        req.level = log_level
+        self._send_message(req)
+
     def _recv(self, amount):
         ret = bytes()
         if amount == 0:
@@ -424,6 +440,13 @@ def run_logs(config, address):
     stopping = False
     retry_timer = []
 
+    image = None
+    if os.path.isfile(CORE.firmware_elf):
+        try:
+            image = FirmwareImage.from_file(CORE.firmware_elf)
+        except (OSError, ValueError) as err:
+            _LOGGER.debug("Can't read firmware ELF file %s: %s", CORE.firmware_elf, err)
+
     has_connects = []
 
     def try_connect(err, tries=0):
@@ -467,9 +490,25 @@ def run_logs(config, address):
                                   'TCP buffer - This is only cosmetic)')
         safe_print(time_ + text)
 
+    def on_binary_log(decoder, msg):
+        time_ = datetime.now().time().strftime('[%H:%M:%S]')
+        safe_print(time_ + decoder.decode(msg))
+
+    def use_binary_logs():
+        # Binary logs can only be decoded with the ELF file of the firmware running on the device
+        if image is None:
+            return False
+        compilation_time = cli.device_info().compilation_time
+        return bool(compilation_time) and image.contains(compilation_time.encode())
+
     def on_login():
         try:
-            cli.subscribe_logs(on_log, dump_config=not has_connects)
+            if use_binary_logs():
+                _LOGGER.info("Using binary logs, decoded with %s", CORE.firmware_elf)
+                cli.subscribe_binary_logs(functools.partial(on_binary_log, BinaryLogDecoder(image)),
+                                          dump_config=not has_connects)
+            else:
+                cli.subscribe_logs(on_log, dump_config=not has_connects)
             has_connects.append(True)
         except APIConnectionError:
             cli.disconnect()
@@ -0,0 +1,175 @@
+"""Decoder for deferred-format binary log messages.
+
+With binary logging the device doesn't format log messages itself. It only sends the addresses of the
+tag and format strings in the firmware image together with the raw printf arguments (see
+esphome/components/logger/binary_log.h). This module looks the strings up in the firmware ELF file
+and formats the message the same way the device would have.
+"""
+import re
+import struct
+from typing import Dict, List, Optional, Tuple
+
+from esphome.api.api_pb2 import BinaryLogResponse
+
+LOG_LEVEL_COLORS = [
+    '',  # NONE
+    '\033[1;31m',  # ERROR
+    '\033[0;33m',  # WARNING
+    '\033[0;32m',  # INFO
+    '\033[0;35m',  # CONFIG
+    '\033[0;36m',  # DEBUG
+    '\033[0;37m',  # VERBOSE
+    '\033[0;38m',  # VERY_VERBOSE
+]
+LOG_LEVEL_LETTERS = ['', 'E', 'W', 'I', 'C', 'D', 'V', 'VV']
+LOG_RESET_COLOR = '\033[0m'
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+# flags, width, precision, length modifier and conversion of a printf conversion specification
+CONVERSION_RE = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|L|q|j|z|t)?([diouxXcfFeEgGaAspn%])')
+
+
+class FirmwareImage:
+    """The allocated sections of a 32-bit little endian ELF file (like the ESP8266/ESP32 firmware)."""
+
+    def __init__(self, data: bytes):
+        if data[:4] != b'\x7fELF' or data[4] != 1 or data[5] != 1:
+            raise ValueError("Not a 32-bit little endian ELF file")
+        shoff, = struct.unpack_from('<I', data, 0x20)
+        shentsize, shnum = struct.unpack_from('<HH', data, 0x2E)
+        self._sections = []  # type: List[Tuple[int, bytes]]
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from('<6I', data, shoff + i * shentsize)
+            if not flags & SHF_ALLOC or sh_type == SHT_NOBITS or addr == 0 or size == 0:
+                continue
+            self._sections.append((addr, data[offset:offset + size]))
+        self._strings = {}  # type: Dict[int, Optional[str]]
+
+    @classmethod
+    def from_file(cls, path: str) -> 'FirmwareImage':
+        with open(path, 'rb') as f_handle:
+            return cls(f_handle.read())
+
+    def read_string(self, address: int) -> Optional[str]:
+        """Read the null terminated string at address, or None if it's not in the image."""
+        if address in self._strings:
+            return self._strings[address]
+        ret = None
+        for start, content in self._sections:
+            if start <= address < start + len(content):
+                offset = address - start
+                end = content.find(b'\0', offset)
+                if end == -1:
+                    end = len(content)
+                ret = content[offset:end].decode('utf-8', errors='replace')
+                break
+        self._strings[address] = ret
+        return ret
+
+    def contains(self, needle: bytes) -> bool:
+        return any(needle in content for _, content in self._sections)
+
+
+class _ArgReader:
+    def __init__(self, data: bytes):
+        self._data = data
+        self._pos = 0
+
+    def read(self, fmt: str):
+        size = struct.calcsize(fmt)
+        if self._pos + size > len(self._data):
+            raise IndexError
+        value, = struct.unpack_from(fmt, self._data, self._pos)
+        self._pos += size
+        return value
+
+    def read_string(self) -> str:
+        end = self._data.find(b'\0', self._pos)
+        if end == -1:
+            raise IndexError
+        value = self._data[self._pos:end].decode('utf-8', errors='replace')
+        self._pos = end + 1
+        return value
+
+
+def _read_integer(reader: _ArgReader, conversion: str, length: Optional[str]) -> int:
+    signed = conversion in 'di'
+    if length in ('ll', 'q', 'j'):
+        return reader.read('<q' if signed else '<Q')
+    value = reader.read('<i' if signed else '<I')
+    # Arguments are promoted to int, the conversion truncates them again
+    bits = {'h': 16, 'hh': 8}.get(length)
+    if bits is not None:
+        value &= (1 << bits) - 1
+        if signed and value >= 1 << (bits - 1):
+            value -= 1 << bits
+    return value
+
+
+def format_message(fmt: str, args: bytes) -> str:
+    """Format a printf format string with the binary encoded arguments of a log message."""
+    reader = _ArgReader(args)
+    parts = []
+    last = 0
+    for match in CONVERSION_RE.finditer(fmt):
+        parts.append(fmt[last:match.start()])
+        last = match.end()
+        flags, width, precision, length, conversion = match.groups()
+        if conversion == '%':
+            parts.append('%')
+            continue
+        try:
+            if width == '*':
+                width = str(reader.read('<i'))
+            if precision == '*':
+                precision = str(reader.read('<i'))
+            spec = '%' + flags + (width or '')
+            if precision is not None:
+                spec += '.' + (precision or '0')
+
+            if conversion in 'diouxXc':
+                value = _read_integer(reader, conversion, length)
+                if conversion == 'c':
+                    parts.append((spec + 'c') % (value & 0xFF))
+                else:
+                    parts.append((spec + conversion.replace('u', 'd').replace('i', 'd')) % value)
+            elif conversion in 'fFeEgG':
+                parts.append((spec + conversion) % reader.read('<d'))
+            elif conversion in 'aA':
+                value = float.hex(reader.read('<d'))
+                parts.append(value.upper() if conversion == 'A' else value)
+            elif conversion == 's':
+                parts.append((spec + 's') % reader.read_string())
+            elif conversion == 'p':
+                parts.append('0x%x' % reader.read('<I'))
+            elif conversion == 'n':
+                reader.read('<I')
+        except IndexError:
+            # The device truncates messages that are too long for its buffer
+            parts.append('<truncated>')
+            return ''.join(parts)
+    parts.append(fmt[last:])
+    return ''.join(parts)
+
+
+class BinaryLogDecoder:
+    def __init__(self, image: FirmwareImage):
+        self._image = image
+
+    def decode(self, msg: BinaryLogResponse) -> str:
+        """Format a binary log message like the device would format it as text."""
+        level = max(0, min(msg.level, 7))
+        tag = self._image.read_string(msg.tag)
+        if tag is None:
+            tag = f'0x{msg.tag:08X}'
+        fmt = self._image.read_string(msg.format)
+        if fmt is None:
+            message = f'<unknown format string 0x{msg.format:08X}: {msg.args.hex()}>'
+        else:
+            message = format_message(fmt, msg.args)
+        if message.endswith('\n'):
+            message = message[:-1]
+        return (f'{LOG_LEVEL_COLORS[level]}[{LOG_LEVEL_LETTERS[level]}][{tag}:{msg.line:03}]: '
+                f'{message}{LOG_RESET_COLOR}')
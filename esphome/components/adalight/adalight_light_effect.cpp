@@ -41,9 +41,8 @@ void AdalightLightEffect::reset_frame_(light::AddressableLight &it) {
 }
 
 void AdalightLightEffect::blank_all_leds_(light::AddressableLight &it) {
-  for (int led = it.size(); led-- > 0;) {
-    it[led].set(light::ESPColor::BLACK);
-  }
+  it.fill(0, it.size(), light::ESPColor::BLACK);
+  it.schedule_show();
 }
 
 void AdalightLightEffect::apply(light::AddressableLight &it, const light::ESPColor &current_color) {
@@ -90,6 +89,7 @@ void AdalightLightEffect::apply(light::AddressableLight &it, const light::ESPCol
 
       case CONSUMED:
         ESP_LOGV(TAG, "Frame: Consumed (size=%zu).", this->frame_.size());
+        it.schedule_show();
         reset_frame_(it);
         break;
     }
@@ -125,13 +125,14 @@ AdalightLightEffect::Frame AdalightLightEffect::parse_frame_(light::AddressableL
 
   // Apply lights
   auto accepted_led_count = std::min<int>(led_count, it.size());
-  uint8_t *led_data = &frame_[6];
-
-  for (int led = 0; led < accepted_led_count; led++, led_data += 3) {
-    auto white = std::min(std::min(led_data[0], led_data[1]), led_data[2]);
-
-    it[led].set(light::ESPColor(led_data[0], led_data[1], led_data[2], white));
-  }
+  const uint8_t *led_data = &frame_[6];
+
+  it.write_generated(0, accepted_led_count, [&led_data](int32_t) {
+    const uint8_t *rgb = led_data;
+    led_data += 3;
+    auto white = std::min(std::min(rgb[0], rgb[1]), rgb[2]);
+    return light::ESPColor(rgb[0], rgb[1], rgb[2], white);
+  });
 
   return CONSUMED;
 }
@@ -28,6 +28,8 @@ class AdalightLightEffect : public light::AddressableLightEffect, public uart::U
   int get_frame_size_(int led_count) const;
   void reset_frame_(light::AddressableLight &it);
   void blank_all_leds_(light::AddressableLight &it);
+  // show every received frame as soon as possible
+  bool schedules_show_() const override { return true; }
   Frame parse_frame_(light::AddressableLight &it);
 
  protected:
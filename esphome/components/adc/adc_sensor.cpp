@@ -9,6 +9,7 @@ namespace esphome {
 namespace adc {
 
 static const char *TAG = "adc";
+static const uint8_t ADC_MAX_SAMPLES = 64;
 
 #ifdef ARDUINO_ARCH_ESP32
 void ADCSensor::set_attenuation(adc_attenuation_t attenuation) { this->attenuation_ = attenuation; }
@@ -50,13 +51,27 @@ void ADCSensor::dump_config() {
       break;
   }
 #endif
+  if (this->samples_ > 1) {
+    ESP_LOGCONFIG(TAG, "  Samples: %u", this->samples_);
+  }
   LOG_UPDATE_INTERVAL(this);
 }
 float ADCSensor::get_setup_priority() const { return setup_priority::DATA; }
 void ADCSensor::update() {
-  float value_v = this->sample();
-  ESP_LOGD(TAG, "'%s': Got voltage=%.2fV", this->get_name().c_str(), value_v);
-  this->publish_state(value_v);
+  if (this->samples_ <= 1) {
+    float value_v = this->sample();
+    ESP_LOGD(TAG, "'%s': Got voltage=%.2fV", this->get_name().c_str(), value_v);
+    this->publish_state(value_v);
+    return;
+  }
+
+  // Sample first and filter afterwards, so that the readings are evenly spaced
+  float values_v[ADC_MAX_SAMPLES];
+  const uint8_t count = std::min(this->samples_, ADC_MAX_SAMPLES);
+  for (uint8_t i = 0; i < count; i++)
+    values_v[i] = this->sample();
+  ESP_LOGD(TAG, "'%s': Got %u voltages, last=%.2fV", this->get_name().c_str(), count, values_v[count - 1]);
+  this->publish_states(values_v, count);
 }
 float ADCSensor::sample() {
 #ifdef ARDUINO_ARCH_ESP32
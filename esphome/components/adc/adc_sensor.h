@@ -24,6 +24,11 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   /// `HARDWARE_LATE` setup priority.
   float get_setup_priority() const override;
   void set_pin(uint8_t pin) { this->pin_ = pin; }
+  /** Take this many readings back to back on each update and publish all of them.
+   *
+   * Meant to be combined with filters that reduce them again, for example sliding_window_moving_average.
+   */
+  void set_samples(uint8_t samples) { this->samples_ = samples; }
   float sample() override;
 
 #ifdef ARDUINO_ARCH_ESP8266
@@ -32,6 +37,7 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
 
  protected:
   uint8_t pin_;
+  uint8_t samples_{1};
 
 #ifdef ARDUINO_ARCH_ESP32
   adc_attenuation_t attenuation_{ADC_0db};
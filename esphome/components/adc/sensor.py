@@ -2,8 +2,8 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
 from esphome.components import sensor, voltage_sampler
-from esphome.const import CONF_ATTENUATION, CONF_ID, CONF_PIN, DEVICE_CLASS_VOLTAGE, ICON_EMPTY, \
-    UNIT_VOLT
+from esphome.const import CONF_ATTENUATION, CONF_ID, CONF_PIN, CONF_SAMPLES, DEVICE_CLASS_VOLTAGE, \
+    ICON_EMPTY, UNIT_VOLT
 
 
 AUTO_LOAD = ['voltage_sampler']
@@ -32,6 +32,7 @@ CONFIG_SCHEMA = sensor.sensor_schema(UNIT_VOLT, ICON_EMPTY, 2, DEVICE_CLASS_VOLT
     cv.Required(CONF_PIN): validate_adc_pin,
     cv.SplitDefault(CONF_ATTENUATION, esp32='0db'):
         cv.All(cv.only_on_esp32, cv.enum(ATTENUATION_MODES, lower=True)),
+    cv.Optional(CONF_SAMPLES, default=1): cv.int_range(min=1, max=64),
 }).extend(cv.polling_component_schema('60s'))
 
 
@@ -45,5 +46,7 @@ def to_code(config):
     else:
         cg.add(var.set_pin(config[CONF_PIN]))
 
+    cg.add(var.set_samples(config[CONF_SAMPLES]))
+
     if CONF_ATTENUATION in config:
         cg.add(var.set_attenuation(config[CONF_ATTENUATION]))
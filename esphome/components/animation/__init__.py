@@ -17,11 +17,14 @@ Animation_ = display.display_ns.class_('Animation')
 
 CONF_RAW_DATA_ID = 'raw_data_id'
 
+# Animations don't support the RGBA image type
+ANIMATION_TYPE = {key: espImage.IMAGE_TYPE[key] for key in ('BINARY', 'GRAYSCALE', 'RGB24')}
+
 ANIMATION_SCHEMA = cv.Schema({
     cv.Required(CONF_ID): cv.declare_id(Animation_),
     cv.Required(CONF_FILE): cv.file_,
     cv.Optional(CONF_RESIZE): cv.dimensions,
-    cv.Optional(CONF_TYPE, default='BINARY'): cv.enum(espImage.IMAGE_TYPE, upper=True),
+    cv.Optional(CONF_TYPE, default='BINARY'): cv.enum(ANIMATION_TYPE, upper=True),
     cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
 })
 
@@ -16,6 +16,10 @@ APIServer = api_ns.class_('APIServer', cg.Component, cg.Controller)
 HomeAssistantServiceCallAction = api_ns.class_('HomeAssistantServiceCallAction', automation.Action)
 APIConnectedCondition = api_ns.class_('APIConnectedCondition', Condition)
 
+CONF_BATCH_DELAY = 'batch_delay'
+CONF_LIST_ENTITIES_CACHE = 'list_entities_cache'
+CONF_MAX_MESSAGE_SIZE = 'max_message_size'
+
 UserServiceTrigger = api_ns.class_('UserServiceTrigger', automation.Trigger)
 ListEntitiesServicesArgument = api_ns.class_('ListEntitiesServicesArgument')
 SERVICE_ARG_NATIVE_TYPES = {
@@ -34,6 +38,9 @@ CONFIG_SCHEMA = cv.Schema({
     cv.Optional(CONF_PORT, default=6053): cv.port,
     cv.Optional(CONF_PASSWORD, default=''): cv.string_strict,
     cv.Optional(CONF_REBOOT_TIMEOUT, default='15min'): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_BATCH_DELAY): cv.positive_time_period_milliseconds,
+    cv.SplitDefault(CONF_LIST_ENTITIES_CACHE, esp8266=False, esp32=True): cv.boolean,
+    cv.Optional(CONF_MAX_MESSAGE_SIZE, default=4096): cv.int_range(min=256, max=65536),
     cv.Optional(CONF_SERVICES): automation.validate_automation({
         cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(UserServiceTrigger),
         cv.Required(CONF_SERVICE): cv.valid_name,
@@ -52,6 +59,10 @@ def to_code(config):
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
+    if CONF_BATCH_DELAY in config:
+        cg.add(var.set_batch_delay(config[CONF_BATCH_DELAY]))
+    cg.add(var.set_list_entities_cache(config[CONF_LIST_ENTITIES_CACHE]))
+    cg.add(var.set_max_message_size(config[CONF_MAX_MESSAGE_SIZE]))
 
     for conf in config.get(CONF_SERVICES, []):
         template_args = []
@@ -9,6 +9,9 @@
 #ifdef USE_HOMEASSISTANT_TIME
 #include "esphome/components/homeassistant/time/homeassistant_time.h"
 #endif
+#ifdef USE_LOGGER
+#include "esphome/components/logger/logger.h"
+#endif
 
 namespace esphome {
 namespace api {
@@ -26,59 +29,108 @@ APIConnection::APIConnection(AsyncClient *client, APIServer *parent)
                         this);
 
   this->send_buffer_.reserve(64);
-  this->recv_buffer_.reserve(32);
+  this->recv_buffer_.set_max_message_size(parent->get_max_message_size());
   this->client_info_ = this->client_->remoteIP().toString().c_str();
   this->last_traffic_ = millis();
 }
-APIConnection::~APIConnection() { delete this->client_; }
-void APIConnection::on_error_(int8_t error) { this->remove_ = true; }
-void APIConnection::on_disconnect_() { this->remove_ = true; }
-void APIConnection::on_timeout_(uint32_t time) { this->on_fatal_error(); }
+APIConnection::~APIConnection() {
+  this->set_log_subscription_(ESPHOME_LOG_LEVEL_NONE, false);
+  this->set_log_subscription_(ESPHOME_LOG_LEVEL_NONE, true);
+  delete this->client_;
+}
+void APIConnection::set_log_subscription_(int level, bool binary) {
+  int &subscription = binary ? this->binary_log_subscription_ : this->log_subscription_;
+  const bool was_subscribed = subscription != ESPHOME_LOG_LEVEL_NONE;
+  const bool is_subscribed = level != ESPHOME_LOG_LEVEL_NONE;
+  subscription = level;
+#ifdef USE_LOGGER
+  // The logger only formats (or encodes) messages while someone is listening
+  auto *log = logger::global_logger;
+  if (log == nullptr || was_subscribed == is_subscribed)
+    return;
+  if (binary) {
+    if (is_subscribed) {
+      log->add_binary_listener();
+    } else {
+      log->remove_binary_listener();
+    }
+  } else {
+    if (is_subscribed) {
+      log->add_text_listener();
+    } else {
+      log->remove_text_listener();
+    }
+  }
+#endif
+}
+void APIConnection::on_error_(int8_t error) {
+  this->remove_ = true;
+  this->parent_->on_client_event();
+}
+void APIConnection::on_disconnect_() {
+  this->remove_ = true;
+  this->parent_->on_client_event();
+}
+void APIConnection::on_timeout_(uint32_t time) {
+  this->on_fatal_error();
+  this->parent_->on_client_event();
+}
 void APIConnection::on_data_(uint8_t *buf, size_t len) {
   if (len == 0 || buf == nullptr)
     return;
-  this->recv_buffer_.insert(this->recv_buffer_.end(), buf, buf + len);
+  this->recv_buffer_.append(buf, len);
+  if (this->recv_buffer_.available() > API_RECV_BUFFER_SIZE) {
+    this->client_->ackLater();
+    this->recv_unacked_ += len;
+  }
+  this->parent_->on_client_event();
+}
+bool APIConnection::is_idle_() const {
+  // Incomplete frames in the receive buffer don't count, on_data_() wakes the loop when the rest arrives
+  if (this->remove_ || this->next_close_ || this->list_entities_streaming_ || !this->pending_state_updates_.empty())
+    return false;
+  if (this->list_entities_iterator_.is_running() || this->initial_state_iterator_.is_running())
+    return false;
+#ifdef USE_ESP32_CAMERA
+  if (this->image_reader_.available())
+    return false;
+#endif
+  return true;
 }
 void APIConnection::parse_recv_buffer_() {
-  if (this->recv_buffer_.empty() || this->remove_)
+  if (this->remove_)
     return;
 
-  while (!this->recv_buffer_.empty()) {
-    if (this->recv_buffer_[0] != 0x00) {
+  APIFrame frame{};
+  while (true) {
+    const APIFrameResult result = this->recv_buffer_.next_frame(&frame);
+    if (result == APIFrameResult::INCOMPLETE)
+      break;
+    if (result == APIFrameResult::INVALID_PREAMBLE) {
       ESP_LOGW(TAG, "Invalid preamble from %s", this->client_info_.c_str());
       this->on_fatal_error();
       return;
     }
-    uint32_t i = 1;
-    const uint32_t size = this->recv_buffer_.size();
-    uint32_t consumed;
-    auto msg_size_varint = ProtoVarInt::parse(&this->recv_buffer_[i], size - i, &consumed);
-    if (!msg_size_varint.has_value())
-      // not enough data there yet
-      return;
-    i += consumed;
-    uint32_t msg_size = msg_size_varint->as_uint32();
-
-    auto msg_type_varint = ProtoVarInt::parse(&this->recv_buffer_[i], size - i, &consumed);
-    if (!msg_type_varint.has_value())
-      // not enough data there yet
-      return;
-    i += consumed;
-    uint32_t msg_type = msg_type_varint->as_uint32();
-
-    if (size - i < msg_size)
-      // message body not fully received
+    if (result == APIFrameResult::TOO_LARGE) {
+      ESP_LOGW(TAG, "Message from %s is larger than max_message_size (%u bytes), disconnecting",
+               this->client_info_.c_str(), this->recv_buffer_.get_max_message_size());
+      this->on_fatal_error();
       return;
+    }
 
-    uint8_t *msg = &this->recv_buffer_[i];
-    this->read_message(msg_size, msg_type, msg);
+    // Decoded in place, the message data stays in the receive buffer
+    this->read_message(frame.size, frame.type, frame.data);
     if (this->remove_)
       return;
-    // pop front
-    uint32_t total = i + msg_size;
-    this->recv_buffer_.erase(this->recv_buffer_.begin(), this->recv_buffer_.begin() + total);
     this->last_traffic_ = millis();
   }
+  this->recv_buffer_.compact();
+
+  if (this->recv_unacked_ != 0) {
+    // Let the client send more again
+    this->client_->ack(this->recv_unacked_);
+    this->recv_unacked_ = 0;
+  }
 }
 
 void APIConnection::disconnect_client() {
@@ -108,9 +160,14 @@ void APIConnection::loop() {
   }
   this->parse_recv_buffer_();
 
+  if (this->list_entities_streaming_)
+    this->send_list_entities_cache_();
   this->list_entities_iterator_.advance();
   this->initial_state_iterator_.advance();
 
+  if (!this->pending_state_updates_.empty() && millis() - this->pending_since_ >= *this->parent_->get_batch_delay())
+    this->flush_state_updates_();
+
   const uint32_t keepalive = 60000;
   if (this->sent_ping_) {
     // Disconnect if not responded within 2.5*keepalive
@@ -129,7 +186,7 @@ void APIConnection::loop() {
     // reserve 15 bytes for metadata, and at least 64 bytes of data
     if (space >= 15 + 64) {
       uint32_t to_send = std::min(space - 15, this->image_reader_.available());
-      auto buffer = this->create_buffer();
+      auto buffer = this->create_buffer(15 + to_send);
       // fixed32 key = 1;
       buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
       // bytes data = 2;
@@ -150,6 +207,172 @@ void APIConnection::loop() {
 #endif
 }
 
+void APIConnection::list_entities(const ListEntitiesRequest &msg) {
+  if (!this->parent_->is_list_entities_cache_enabled()) {
+    this->list_entities_iterator_.begin();
+    return;
+  }
+
+  // Keep sending the current stream, restarting it could cut a frame that was only sent in part
+  if (this->list_entities_streaming_)
+    return;
+  // Not built yet, or an entity was renamed since
+  if (this->parent_->get_list_entities_cache() == nullptr) {
+    const uint32_t start = micros();
+    auto cache = std::make_shared<std::vector<uint8_t>>();
+    // Run the iterator at once, collecting the messages instead of sending them
+    this->capture_buffer_ = cache.get();
+    this->list_entities_iterator_.begin();
+    while (this->list_entities_iterator_.is_running())
+      this->list_entities_iterator_.advance();
+    this->capture_buffer_ = nullptr;
+    cache->shrink_to_fit();
+    ESP_LOGD(TAG, "Encoded entity descriptions (%u bytes) in %u us", cache->size(), micros() - start);
+    this->parent_->store_list_entities_cache(std::move(cache));
+  }
+  this->list_entities_cache_ = this->parent_->get_list_entities_cache();
+  this->list_entities_offset_ = 0;
+  this->list_entities_frame_end_ = 0;
+  this->list_entities_streaming_ = true;
+}
+
+void APIConnection::send_list_entities_cache_() {
+  const std::vector<uint8_t> &cache = *this->list_entities_cache_;
+  const size_t space = this->client_->space();
+  if (space == 0)
+    return;
+  size_t end = this->list_entities_offset_;
+  if (end < this->list_entities_frame_end_) {
+    // Finish the frame that was sent in pieces first
+    end = std::min(this->list_entities_frame_end_, end + space);
+  } else {
+    // Send complete frames, so that other messages can be sent in between
+    while (end < cache.size()) {
+      uint32_t consumed;
+      size_t i = end + 1;
+      const uint32_t msg_size = ProtoVarInt::parse(&cache[i], cache.size() - i, &consumed)->as_uint32();
+      i += consumed;
+      ProtoVarInt::parse(&cache[i], cache.size() - i, &consumed);
+      i += consumed + msg_size;
+      if (i - this->list_entities_offset_ > space) {
+        if (end == this->list_entities_offset_) {
+          // The frame may be larger than the whole TCP send buffer, send it in pieces. send_buffer() holds other
+          // messages back until it is complete.
+          this->list_entities_frame_end_ = i;
+          end += space;
+        }
+        break;
+      }
+      end = i;
+    }
+  }
+  if (end == this->list_entities_offset_)
+    return;
+
+  // The cache is never changed and this connection keeps it alive, so the TCP stack can send straight from it
+  this->client_->add(reinterpret_cast<const char *>(&cache[this->list_entities_offset_]),
+                     end - this->list_entities_offset_, 0);
+  this->client_->send();
+  this->list_entities_offset_ = end;
+  if (end == cache.size())
+    this->list_entities_streaming_ = false;
+}
+
+void APIConnection::send_state_update(StateUpdateType type, Nameable *entity) {
+  if (this->remove_ || !this->state_subscription_)
+    return;
+  if (!this->parent_->get_batch_delay().has_value()) {
+    this->send_state_now_(type, entity);
+    return;
+  }
+
+  StateBatchStats &stats = this->parent_->get_batch_stats();
+  stats.updates++;
+  for (auto &update : this->pending_state_updates_) {
+    if (update.entity == entity) {
+      // The state is only read when the batch is sent, so the queued entry already covers this update
+      update.coalesced++;
+      stats.coalesced++;
+      return;
+    }
+  }
+  if (this->pending_state_updates_.empty()) {
+    this->pending_since_ = millis();
+    this->parent_->on_client_event();
+  }
+  this->pending_state_updates_.push_back(PendingStateUpdate{type, entity, 0});
+}
+
+bool APIConnection::send_state_now_(StateUpdateType type, Nameable *entity) {
+  switch (type) {
+#ifdef USE_BINARY_SENSOR
+    case StateUpdateType::BINARY_SENSOR: {
+      auto *obj = static_cast<binary_sensor::BinarySensor *>(entity);
+      return this->send_binary_sensor_state(obj, obj->state);
+    }
+#endif
+#ifdef USE_COVER
+    case StateUpdateType::COVER:
+      return this->send_cover_state(static_cast<cover::Cover *>(entity));
+#endif
+#ifdef USE_FAN
+    case StateUpdateType::FAN:
+      return this->send_fan_state(static_cast<fan::FanState *>(entity));
+#endif
+#ifdef USE_LIGHT
+    case StateUpdateType::LIGHT:
+      return this->send_light_state(static_cast<light::LightState *>(entity));
+#endif
+#ifdef USE_SENSOR
+    case StateUpdateType::SENSOR: {
+      auto *obj = static_cast<sensor::Sensor *>(entity);
+      return this->send_sensor_state(obj, obj->state);
+    }
+#endif
+#ifdef USE_SWITCH
+    case StateUpdateType::SWITCH: {
+      auto *obj = static_cast<switch_::Switch *>(entity);
+      return this->send_switch_state(obj, obj->state);
+    }
+#endif
+#ifdef USE_TEXT_SENSOR
+    case StateUpdateType::TEXT_SENSOR: {
+      auto *obj = static_cast<text_sensor::TextSensor *>(entity);
+      return this->send_text_sensor_state(obj, obj->state);
+    }
+#endif
+#ifdef USE_CLIMATE
+    case StateUpdateType::CLIMATE:
+      return this->send_climate_state(static_cast<climate::Climate *>(entity));
+#endif
+    default:
+      return true;
+  }
+}
+
+void APIConnection::flush_state_updates_() {
+  StateBatchStats &stats = this->parent_->get_batch_stats();
+  this->batching_ = true;
+  this->batch_bytes_ = 0;
+  auto it = this->pending_state_updates_.begin();
+  for (; it != this->pending_state_updates_.end(); ++it) {
+    const uint32_t before = this->batch_bytes_;
+    if (!this->send_state_now_(it->type, it->entity))
+      break;
+    stats.messages++;
+    stats.bytes_saved += it->coalesced * (this->batch_bytes_ - before);
+  }
+  this->batching_ = false;
+  this->pending_state_updates_.erase(this->pending_state_updates_.begin(), it);
+  // Whatever didn't fit is sent in the next loop iteration
+  this->pending_since_ = millis() - *this->parent_->get_batch_delay();
+
+  if (this->batch_bytes_ != 0) {
+    stats.writes++;
+    this->client_->send();
+  }
+}
+
 std::string get_default_unique_id(const std::string &component_type, Nameable *nameable) {
   return App.get_name() + component_type + nameable->get_object_id();
 }
@@ -532,6 +755,7 @@ void APIConnection::send_camera_state(std::shared_ptr<esp32_camera::CameraImage>
   if (this->image_reader_.available())
     return;
   this->image_reader_.set_image(image);
+  this->parent_->on_client_event();
 }
 bool APIConnection::send_camera_info(esp32_camera::ESP32Camera *camera) {
   ListEntitiesCameraResponse msg;
@@ -560,21 +784,23 @@ void APIConnection::on_get_time_response(const GetTimeResponse &value) {
 #endif
 
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
-  if (this->log_subscription_ < level)
+  // Messages logged while the ListEntities cache is built must not end up in it
+  if (this->log_subscription_ < level || this->capture_buffer_ != nullptr)
     return false;
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  const size_t line_len = strlen(line);
+  auto buffer = this->create_buffer(8 + line_len);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string tag = 2;
   // buffer.encode_string(2, tag, strlen(tag));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_len);
   // SubscribeLogsResponse - 29
   bool success = this->send_buffer(buffer, 29);
   if (!success) {
-    buffer = this->create_buffer();
+    buffer = this->create_buffer(2);
     // bool send_failed = 4;
     buffer.encode_bool(4, true);
     return this->send_buffer(buffer, 29);
@@ -583,6 +809,29 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
   }
 }
 
+#ifdef USE_LOGGER
+bool APIConnection::send_binary_log_message(const logger::BinaryLogRecord &record) {
+  // Messages logged while the ListEntities cache is built must not end up in it
+  if (this->binary_log_subscription_ < record.level || this->capture_buffer_ != nullptr)
+    return false;
+
+  // Send raw so that we don't copy the arguments
+  auto buffer = this->create_buffer(24 + record.args_len);
+  // LogLevel level = 1;
+  buffer.encode_uint32(1, static_cast<uint32_t>(record.level));
+  // fixed32 tag = 2;
+  buffer.encode_fixed32(2, reinterpret_cast<uintptr_t>(record.tag));
+  // uint32 line = 3;
+  buffer.encode_uint32(3, record.line);
+  // fixed32 format = 4;
+  buffer.encode_fixed32(4, reinterpret_cast<uintptr_t>(record.format));
+  // bytes args = 5;
+  buffer.encode_bytes(5, record.args, record.args_len);
+  // BinaryLogResponse - 52
+  return this->send_buffer(buffer, 52);
+}
+#endif
+
 HelloResponse APIConnection::hello(const HelloRequest &msg) {
   this->client_info_ = msg.client_info + " (" + this->client_->remoteIP().toString().c_str();
   this->client_info_ += ")";
@@ -644,6 +893,32 @@ void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
     ESP_LOGV(TAG, "Could not find matching service!");
   }
 }
+#ifdef USE_COMPONENT_PROFILER
+static ComponentRuntimeStats make_runtime_stats(std::string name, const RuntimeStats &stats) {
+  ComponentRuntimeStats ret;
+  ret.name = std::move(name);
+  ret.count = stats.get_count();
+  ret.total_us = stats.get_total_us();
+  ret.max_us = stats.get_max_us();
+  ret.p99_us = stats.get_p99_us();
+  return ret;
+}
+ComponentStatsResponse APIConnection::component_stats(const ComponentStatsRequest &msg) {
+  ComponentStatsResponse resp;
+  for (auto *component : App.get_components()) {
+    resp.setup.push_back(make_runtime_stats(component->get_component_source(), component->get_setup_stats()));
+    if (component->get_loop_stats().get_count() != 0)
+      resp.loop.push_back(make_runtime_stats(component->get_component_source(), component->get_loop_stats()));
+  }
+  for (auto &it : App.scheduler.get_callback_stats()) {
+    std::string name = it.component != nullptr ? it.component->get_component_source() : "<unknown>";
+    name += "/";
+    name += it.name;
+    resp.scheduler.push_back(make_runtime_stats(std::move(name), it.stats));
+  }
+  return resp;
+}
+#endif
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   for (auto &it : this->parent_->get_state_subs()) {
     SubscribeHomeAssistantStateResponse resp;
@@ -655,15 +930,26 @@ void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistant
   }
 }
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
-  if (this->remove_)
+  if (this->remove_ && this->capture_buffer_ == nullptr)
     return false;
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(buffer.get_buffer()->size()).encode(header);
-  ProtoVarInt(message_type).encode(header);
+  // Write the header right in front of the message, so that both go out with a single write
+  std::vector<uint8_t> &data = *buffer.get_buffer();
+  const uint32_t msg_size = data.size() - API_MAX_HEADER_SIZE;
+  const uint32_t header_size = 1 + ProtoSize::varint(msg_size) + ProtoSize::varint(message_type);
+  uint8_t *header = &data[API_MAX_HEADER_SIZE - header_size];
+  header[0] = 0x00;
+  ProtoVarInt(message_type).encode_to(ProtoVarInt(msg_size).encode_to(header + 1));
 
-  size_t needed_space = buffer.get_buffer()->size() + header.size();
+  size_t needed_space = header_size + msg_size;
+
+  if (this->capture_buffer_ != nullptr) {
+    this->capture_buffer_->insert(this->capture_buffer_->end(), header, header + needed_space);
+    return true;
+  }
+  // Don't interleave with a ListEntities frame that was only sent in part
+  if (this->list_entities_offset_ < this->list_entities_frame_end_)
+    return false;
 
   if (needed_space > this->client_->space()) {
     delay(0);
@@ -677,10 +963,14 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
   }
 
-  this->client_->add(reinterpret_cast<char *>(header.data()), header.size(),
-                     ASYNC_WRITE_FLAG_COPY | ASYNC_WRITE_FLAG_MORE);
-  this->client_->add(reinterpret_cast<char *>(buffer.get_buffer()->data()), buffer.get_buffer()->size(),
-                     ASYNC_WRITE_FLAG_COPY);
+  // The send buffer is reused for the next message, so the TCP stack has to keep its own copy until it's acked
+  if (this->batching_) {
+    // Only queue the message, flush_state_updates_() sends the whole batch at once
+    this->client_->add(reinterpret_cast<char *>(header), needed_space, ASYNC_WRITE_FLAG_COPY | ASYNC_WRITE_FLAG_MORE);
+    this->batch_bytes_ += needed_space;
+    return true;
+  }
+  this->client_->add(reinterpret_cast<char *>(header), needed_space, ASYNC_WRITE_FLAG_COPY);
   bool ret = this->client_->send();
   return ret;
 }
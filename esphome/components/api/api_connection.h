@@ -5,10 +5,33 @@
 #include "api_pb2.h"
 #include "api_pb2_service.h"
 #include "api_server.h"
+#include "recv_buffer.h"
+
+#ifdef USE_LOGGER
+#include "esphome/components/logger/binary_log.h"
+#endif
 
 namespace esphome {
 namespace api {
 
+/// Space reserved in front of every message for the preamble, message size and message type.
+static const uint8_t API_MAX_HEADER_SIZE = 1 + 5 + 5;
+/// Received data beyond this many unparsed bytes is only acknowledged once it's parsed, so that the TCP window
+/// throttles clients that send faster than messages are handled.
+static const uint32_t API_RECV_BUFFER_SIZE = 1024;
+
+/// The kind of entity of a queued state update.
+enum class StateUpdateType : uint8_t {
+  BINARY_SENSOR,
+  COVER,
+  FAN,
+  LIGHT,
+  SENSOR,
+  SWITCH,
+  TEXT_SENSOR,
+  CLIMATE,
+};
+
 class APIConnection : public APIServerConnection {
  public:
   APIConnection(AsyncClient *client, APIServer *parent);
@@ -63,7 +86,16 @@ class APIConnection : public APIServerConnection {
   bool send_climate_info(climate::Climate *climate);
   void climate_command(const ClimateCommandRequest &msg) override;
 #endif
+  /** Send the current state of an entity to the client, if it's subscribed to states.
+   *
+   * With a batch delay set on the server, the update is only queued and all queued updates are sent together with
+   * a single write later. An entity that's updated again before that is sent only once, with its latest state.
+   */
+  void send_state_update(StateUpdateType type, Nameable *entity);
   bool send_log_message(int level, const char *tag, const char *line);
+#ifdef USE_LOGGER
+  bool send_binary_log_message(const logger::BinaryLogRecord &record);
+#endif
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
     if (!this->service_call_subscription_)
       return;
@@ -98,13 +130,18 @@ class APIConnection : public APIServerConnection {
   }
   PingResponse ping(const PingRequest &msg) override { return {}; }
   DeviceInfoResponse device_info(const DeviceInfoRequest &msg) override;
-  void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
+  void list_entities(const ListEntitiesRequest &msg) override;
   void subscribe_states(const SubscribeStatesRequest &msg) override {
     this->state_subscription_ = true;
     this->initial_state_iterator_.begin();
   }
   void subscribe_logs(const SubscribeLogsRequest &msg) override {
-    this->log_subscription_ = msg.level;
+    this->set_log_subscription_(msg.level, false);
+    if (msg.dump_config)
+      App.schedule_dump_config();
+  }
+  void subscribe_binary_logs(const SubscribeBinaryLogsRequest &msg) override {
+    this->set_log_subscription_(msg.level, true);
     if (msg.dump_config)
       App.schedule_dump_config();
   }
@@ -117,6 +154,9 @@ class APIConnection : public APIServerConnection {
     return {};
   }
   void execute_service(const ExecuteServiceRequest &msg) override;
+#ifdef USE_COMPONENT_PROFILER
+  ComponentStatsResponse component_stats(const ComponentStatsRequest &msg) override;
+#endif
   bool is_authenticated() override { return this->connection_state_ == ConnectionState::AUTHENTICATED; }
   bool is_connection_setup() override {
     return this->connection_state_ == ConnectionState ::CONNECTED || this->is_authenticated();
@@ -124,13 +164,18 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override {
+    // The header is written into the reserved space once the size of the message is known
     this->send_buffer_.clear();
+    this->send_buffer_.reserve(API_MAX_HEADER_SIZE + reserve_size);
+    this->send_buffer_.resize(API_MAX_HEADER_SIZE);
     return {&this->send_buffer_};
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
 
  protected:
+  /// Update a (binary) log subscription and tell the logger whether it has a listener for this connection.
+  void set_log_subscription_(int level, bool binary);
   friend APIServer;
 
   void on_error_(int8_t error);
@@ -138,6 +183,13 @@ class APIConnection : public APIServerConnection {
   void on_timeout_(uint32_t time);
   void on_data_(uint8_t *buf, size_t len);
   void parse_recv_buffer_();
+  /// Whether loop() has nothing to do until the next event (see APIServer::on_client_event()).
+  bool is_idle_() const;
+  /// Send as many complete frames of the server's ListEntities cache as fit into the TCP buffer.
+  void send_list_entities_cache_();
+  bool send_state_now_(StateUpdateType type, Nameable *entity);
+  /// Send as many queued state updates as fit into the TCP buffer, keeping the rest for the next loop.
+  void flush_state_updates_();
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -148,7 +200,11 @@ class APIConnection : public APIServerConnection {
   bool remove_{false};
 
   std::vector<uint8_t> send_buffer_;
-  std::vector<uint8_t> recv_buffer_;
+  /// While set, send_buffer() appends complete frames to this buffer instead of sending them.
+  std::vector<uint8_t> *capture_buffer_{nullptr};
+  APIRecvBuffer recv_buffer_;
+  /// Bytes received but not acknowledged to the TCP stack yet.
+  size_t recv_unacked_{0};
 
   std::string client_info_;
 #ifdef USE_ESP32_CAMERA
@@ -156,7 +212,20 @@ class APIConnection : public APIServerConnection {
 #endif
 
   bool state_subscription_{false};
+  struct PendingStateUpdate {
+    StateUpdateType type;
+    Nameable *entity;
+    /// How many updates of this entity were replaced by a newer one while queued.
+    uint16_t coalesced;
+  };
+  std::vector<PendingStateUpdate> pending_state_updates_;
+  /// The time the oldest queued state update was queued.
+  uint32_t pending_since_{0};
+  /// While set, send_buffer() only queues messages in the TCP stack, flush_state_updates_() sends them.
+  bool batching_{false};
+  uint32_t batch_bytes_{0};
   int log_subscription_{ESPHOME_LOG_LEVEL_NONE};
+  int binary_log_subscription_{ESPHOME_LOG_LEVEL_NONE};
   uint32_t last_traffic_;
   bool sent_ping_{false};
   bool service_call_subscription_{false};
@@ -166,6 +235,13 @@ class APIConnection : public APIServerConnection {
   APIServer *parent_;
   InitialStateIterator initial_state_iterator_;
   ListEntitiesIterator list_entities_iterator_;
+  bool list_entities_streaming_{false};
+  /// The ListEntities cache being sent. Kept until the connection is closed, the TCP stack sends straight from it.
+  std::shared_ptr<const std::vector<uint8_t>> list_entities_cache_;
+  /// Offset of the next byte of the ListEntities cache to send.
+  size_t list_entities_offset_{0};
+  /// End of the frame that is being sent in pieces, while list_entities_offset_ is before it.
+  size_t list_entities_frame_end_{0};
 };
 
 }  // namespace api
@@ -189,6 +189,9 @@ bool HelloRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value)
   }
 }
 void HelloRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_string(1, this->client_info); }
+void HelloRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->client_info, false);
+}
 void HelloRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HelloRequest {\n");
@@ -226,6 +229,11 @@ void HelloResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->api_version_minor);
   buffer.encode_string(3, this->server_info);
 }
+void HelloResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32_field(total_size, 1, this->api_version_major, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->api_version_minor, false);
+  ProtoSize::add_string_field(total_size, 1, this->server_info, false);
+}
 void HelloResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HelloResponse {\n");
@@ -255,6 +263,9 @@ bool ConnectRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value
   }
 }
 void ConnectRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_string(1, this->password); }
+void ConnectRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->password, false);
+}
 void ConnectRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ConnectRequest {\n");
@@ -274,6 +285,9 @@ bool ConnectResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   }
 }
 void ConnectResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->invalid_password); }
+void ConnectResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool_field(total_size, 1, this->invalid_password, false);
+}
 void ConnectResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ConnectResponse {\n");
@@ -283,14 +297,19 @@ void ConnectResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 void DisconnectRequest::encode(ProtoWriteBuffer buffer) const {}
+void DisconnectRequest::calculate_size(uint32_t &total_size) const {}
 void DisconnectRequest::dump_to(std::string &out) const { out.append("DisconnectRequest {}"); }
 void DisconnectResponse::encode(ProtoWriteBuffer buffer) const {}
+void DisconnectResponse::calculate_size(uint32_t &total_size) const {}
 void DisconnectResponse::dump_to(std::string &out) const { out.append("DisconnectResponse {}"); }
 void PingRequest::encode(ProtoWriteBuffer buffer) const {}
+void PingRequest::calculate_size(uint32_t &total_size) const {}
 void PingRequest::dump_to(std::string &out) const { out.append("PingRequest {}"); }
 void PingResponse::encode(ProtoWriteBuffer buffer) const {}
+void PingResponse::calculate_size(uint32_t &total_size) const {}
 void PingResponse::dump_to(std::string &out) const { out.append("PingResponse {}"); }
 void DeviceInfoRequest::encode(ProtoWriteBuffer buffer) const {}
+void DeviceInfoRequest::calculate_size(uint32_t &total_size) const {}
 void DeviceInfoRequest::dump_to(std::string &out) const { out.append("DeviceInfoRequest {}"); }
 bool DeviceInfoResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
@@ -341,6 +360,15 @@ void DeviceInfoResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(6, this->model);
   buffer.encode_bool(7, this->has_deep_sleep);
 }
+void DeviceInfoResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool_field(total_size, 1, this->uses_password, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->mac_address, false);
+  ProtoSize::add_string_field(total_size, 1, this->esphome_version, false);
+  ProtoSize::add_string_field(total_size, 1, this->compilation_time, false);
+  ProtoSize::add_string_field(total_size, 1, this->model, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_deep_sleep, false);
+}
 void DeviceInfoResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("DeviceInfoResponse {\n");
@@ -374,10 +402,13 @@ void DeviceInfoResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 void ListEntitiesRequest::encode(ProtoWriteBuffer buffer) const {}
+void ListEntitiesRequest::calculate_size(uint32_t &total_size) const {}
 void ListEntitiesRequest::dump_to(std::string &out) const { out.append("ListEntitiesRequest {}"); }
 void ListEntitiesDoneResponse::encode(ProtoWriteBuffer buffer) const {}
+void ListEntitiesDoneResponse::calculate_size(uint32_t &total_size) const {}
 void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
 void SubscribeStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeStatesRequest::calculate_size(uint32_t &total_size) const {}
 void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
 bool ListEntitiesBinarySensorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
@@ -429,6 +460,14 @@ void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(5, this->device_class);
   buffer.encode_bool(6, this->is_status_binary_sensor);
 }
+void ListEntitiesBinarySensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->device_class, false);
+  ProtoSize::add_bool_field(total_size, 1, this->is_status_binary_sensor, false);
+}
 void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesBinarySensorResponse {\n");
@@ -487,6 +526,11 @@ void BinarySensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void BinarySensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->missing_state, false);
+}
 void BinarySensorStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("BinarySensorStateResponse {\n");
@@ -564,6 +608,16 @@ void ListEntitiesCoverResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(7, this->supports_tilt);
   buffer.encode_string(8, this->device_class);
 }
+void ListEntitiesCoverResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_bool_field(total_size, 1, this->assumed_state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_position, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_tilt, false);
+  ProtoSize::add_string_field(total_size, 1, this->device_class, false);
+}
 void ListEntitiesCoverResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesCoverResponse {\n");
@@ -640,6 +694,13 @@ void CoverStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(4, this->tilt);
   buffer.encode_enum<enums::CoverOperation>(5, this->current_operation);
 }
+void CoverStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_enum_field(total_size, 1, this->legacy_state, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->position != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->tilt != 0.0f, false);
+  ProtoSize::add_enum_field(total_size, 1, this->current_operation, false);
+}
 void CoverStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("CoverStateResponse {\n");
@@ -721,6 +782,16 @@ void CoverCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(7, this->tilt);
   buffer.encode_bool(8, this->stop);
 }
+void CoverCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_legacy_command, false);
+  ProtoSize::add_enum_field(total_size, 1, this->legacy_command, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_position, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->position != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_tilt, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->tilt != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->stop, false);
+}
 void CoverCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("CoverCommandRequest {\n");
@@ -815,6 +886,15 @@ void ListEntitiesFanResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(6, this->supports_speed);
   buffer.encode_bool(7, this->supports_direction);
 }
+void ListEntitiesFanResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_oscillation, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_speed, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_direction, false);
+}
 void ListEntitiesFanResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesFanResponse {\n");
@@ -887,6 +967,13 @@ void FanStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::FanSpeed>(4, this->speed);
   buffer.encode_enum<enums::FanDirection>(5, this->direction);
 }
+void FanStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->oscillating, false);
+  ProtoSize::add_enum_field(total_size, 1, this->speed, false);
+  ProtoSize::add_enum_field(total_size, 1, this->direction, false);
+}
 void FanStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("FanStateResponse {\n");
@@ -971,6 +1058,17 @@ void FanCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(8, this->has_direction);
   buffer.encode_enum<enums::FanDirection>(9, this->direction);
 }
+void FanCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_speed, false);
+  ProtoSize::add_enum_field(total_size, 1, this->speed, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_oscillating, false);
+  ProtoSize::add_bool_field(total_size, 1, this->oscillating, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_direction, false);
+  ProtoSize::add_enum_field(total_size, 1, this->direction, false);
+}
 void FanCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("FanCommandRequest {\n");
@@ -1089,6 +1187,21 @@ void ListEntitiesLightResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_string(11, it, true);
   }
 }
+void ListEntitiesLightResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_brightness, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_rgb, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_white_value, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_color_temperature, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->min_mireds != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->max_mireds != 0.0f, false);
+  for (const auto &it : this->effects) {
+    ProtoSize::add_string_field(total_size, 1, it, true);
+  }
+}
 void ListEntitiesLightResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesLightResponse {\n");
@@ -1207,6 +1320,17 @@ void LightStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(8, this->color_temperature);
   buffer.encode_string(9, this->effect);
 }
+void LightStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->brightness != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->red != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->green != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->blue != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->white != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->color_temperature != 0.0f, false);
+  ProtoSize::add_string_field(total_size, 1, this->effect, false);
+}
 void LightStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("LightStateResponse {\n");
@@ -1369,6 +1493,27 @@ void LightCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(18, this->has_effect);
   buffer.encode_string(19, this->effect);
 }
+void LightCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_brightness, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->brightness != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_rgb, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->red != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->green != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->blue != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_white, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->white != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_color_temperature, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->color_temperature != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_transition_length, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->transition_length, false);
+  ProtoSize::add_bool_field(total_size, 2, this->has_flash_length, false);
+  ProtoSize::add_uint32_field(total_size, 2, this->flash_length, false);
+  ProtoSize::add_bool_field(total_size, 2, this->has_effect, false);
+  ProtoSize::add_string_field(total_size, 2, this->effect, false);
+}
 void LightCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("LightCommandRequest {\n");
@@ -1523,6 +1668,17 @@ void ListEntitiesSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(8, this->force_update);
   buffer.encode_string(9, this->device_class);
 }
+void ListEntitiesSensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->icon, false);
+  ProtoSize::add_string_field(total_size, 1, this->unit_of_measurement, false);
+  ProtoSize::add_int32_field(total_size, 1, this->accuracy_decimals, false);
+  ProtoSize::add_bool_field(total_size, 1, this->force_update, false);
+  ProtoSize::add_string_field(total_size, 1, this->device_class, false);
+}
 void ListEntitiesSensorResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesSensorResponse {\n");
@@ -1594,6 +1750,11 @@ void SensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void SensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->state != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->missing_state, false);
+}
 void SensorStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SensorStateResponse {\n");
@@ -1662,6 +1823,14 @@ void ListEntitiesSwitchResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(5, this->icon);
   buffer.encode_bool(6, this->assumed_state);
 }
+void ListEntitiesSwitchResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->icon, false);
+  ProtoSize::add_bool_field(total_size, 1, this->assumed_state, false);
+}
 void ListEntitiesSwitchResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesSwitchResponse {\n");
@@ -1715,6 +1884,10 @@ void SwitchStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 }
+void SwitchStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+}
 void SwitchStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SwitchStateResponse {\n");
@@ -1752,6 +1925,10 @@ void SwitchCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 }
+void SwitchCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+}
 void SwitchCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SwitchCommandRequest {\n");
@@ -1804,6 +1981,13 @@ void ListEntitiesTextSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(4, this->unique_id);
   buffer.encode_string(5, this->icon);
 }
+void ListEntitiesTextSensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->icon, false);
+}
 void ListEntitiesTextSensorResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesTextSensorResponse {\n");
@@ -1864,6 +2048,11 @@ void TextSensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void TextSensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->missing_state, false);
+}
 void TextSensorStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("TextSensorStateResponse {\n");
@@ -1899,6 +2088,10 @@ void SubscribeLogsRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::LogLevel>(1, this->level);
   buffer.encode_bool(2, this->dump_config);
 }
+void SubscribeLogsRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum_field(total_size, 1, this->level, false);
+  ProtoSize::add_bool_field(total_size, 1, this->dump_config, false);
+}
 void SubscribeLogsRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SubscribeLogsRequest {\n");
@@ -1945,6 +2138,12 @@ void SubscribeLogsResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(3, this->message);
   buffer.encode_bool(4, this->send_failed);
 }
+void SubscribeLogsResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum_field(total_size, 1, this->level, false);
+  ProtoSize::add_string_field(total_size, 1, this->tag, false);
+  ProtoSize::add_string_field(total_size, 1, this->message, false);
+  ProtoSize::add_bool_field(total_size, 1, this->send_failed, false);
+}
 void SubscribeLogsResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SubscribeLogsResponse {\n");
@@ -1965,7 +2164,121 @@ void SubscribeLogsResponse::dump_to(std::string &out) const {
   out.append("\n");
   out.append("}");
 }
+bool SubscribeBinaryLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->level = value.as_enum<enums::LogLevel>();
+      return true;
+    }
+    case 2: {
+      this->dump_config = value.as_bool();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void SubscribeBinaryLogsRequest::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_enum<enums::LogLevel>(1, this->level);
+  buffer.encode_bool(2, this->dump_config);
+}
+void SubscribeBinaryLogsRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum_field(total_size, 1, this->level, false);
+  ProtoSize::add_bool_field(total_size, 1, this->dump_config, false);
+}
+void SubscribeBinaryLogsRequest::dump_to(std::string &out) const {
+  char buffer[64];
+  out.append("SubscribeBinaryLogsRequest {\n");
+  out.append("  level: ");
+  out.append(proto_enum_to_string<enums::LogLevel>(this->level));
+  out.append("\n");
+
+  out.append("  dump_config: ");
+  out.append(YESNO(this->dump_config));
+  out.append("\n");
+  out.append("}");
+}
+bool BinaryLogResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->level = value.as_enum<enums::LogLevel>();
+      return true;
+    }
+    case 3: {
+      this->line = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool BinaryLogResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 5: {
+      this->args = value.as_string();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool BinaryLogResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
+  switch (field_id) {
+    case 2: {
+      this->tag = value.as_fixed32();
+      return true;
+    }
+    case 4: {
+      this->format = value.as_fixed32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void BinaryLogResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_enum<enums::LogLevel>(1, this->level);
+  buffer.encode_fixed32(2, this->tag);
+  buffer.encode_uint32(3, this->line);
+  buffer.encode_fixed32(4, this->format);
+  buffer.encode_string(5, this->args);
+}
+void BinaryLogResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum_field(total_size, 1, this->level, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->tag != 0, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->line, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->format != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->args, false);
+}
+void BinaryLogResponse::dump_to(std::string &out) const {
+  char buffer[64];
+  out.append("BinaryLogResponse {\n");
+  out.append("  level: ");
+  out.append(proto_enum_to_string<enums::LogLevel>(this->level));
+  out.append("\n");
+
+  out.append("  tag: ");
+  sprintf(buffer, "%u", this->tag);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  line: ");
+  sprintf(buffer, "%u", this->line);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  format: ");
+  sprintf(buffer, "%u", this->format);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  args: ");
+  out.append("'").append(this->args).append("'");
+  out.append("\n");
+  out.append("}");
+}
 void SubscribeHomeassistantServicesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeHomeassistantServicesRequest::calculate_size(uint32_t &total_size) const {}
 void SubscribeHomeassistantServicesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeassistantServicesRequest {}");
 }
@@ -1987,6 +2300,10 @@ void HomeassistantServiceMap::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->key);
   buffer.encode_string(2, this->value);
 }
+void HomeassistantServiceMap::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->key, false);
+  ProtoSize::add_string_field(total_size, 1, this->value, false);
+}
 void HomeassistantServiceMap::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HomeassistantServiceMap {\n");
@@ -2044,6 +2361,19 @@ void HomeassistantServiceResponse::encode(ProtoWriteBuffer buffer) const {
   }
   buffer.encode_bool(5, this->is_event);
 }
+void HomeassistantServiceResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->service, false);
+  for (const auto &it : this->data) {
+    ProtoSize::add_message_field<HomeassistantServiceMap>(total_size, 1, it);
+  }
+  for (const auto &it : this->data_template) {
+    ProtoSize::add_message_field<HomeassistantServiceMap>(total_size, 1, it);
+  }
+  for (const auto &it : this->variables) {
+    ProtoSize::add_message_field<HomeassistantServiceMap>(total_size, 1, it);
+  }
+  ProtoSize::add_bool_field(total_size, 1, this->is_event, false);
+}
 void HomeassistantServiceResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HomeassistantServiceResponse {\n");
@@ -2075,6 +2405,7 @@ void HomeassistantServiceResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 void SubscribeHomeAssistantStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeHomeAssistantStatesRequest::calculate_size(uint32_t &total_size) const {}
 void SubscribeHomeAssistantStatesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeAssistantStatesRequest {}");
 }
@@ -2091,6 +2422,9 @@ bool SubscribeHomeAssistantStateResponse::decode_length(uint32_t field_id, Proto
 void SubscribeHomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->entity_id);
 }
+void SubscribeHomeAssistantStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->entity_id, false);
+}
 void SubscribeHomeAssistantStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SubscribeHomeAssistantStateResponse {\n");
@@ -2117,6 +2451,10 @@ void HomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->entity_id);
   buffer.encode_string(2, this->state);
 }
+void HomeAssistantStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->entity_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->state, false);
+}
 void HomeAssistantStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HomeAssistantStateResponse {\n");
@@ -2130,6 +2468,7 @@ void HomeAssistantStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 void GetTimeRequest::encode(ProtoWriteBuffer buffer) const {}
+void GetTimeRequest::calculate_size(uint32_t &total_size) const {}
 void GetTimeRequest::dump_to(std::string &out) const { out.append("GetTimeRequest {}"); }
 bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
   switch (field_id) {
@@ -2142,6 +2481,9 @@ bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
   }
 }
 void GetTimeResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->epoch_seconds); }
+void GetTimeResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->epoch_seconds != 0, false);
+}
 void GetTimeResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("GetTimeResponse {\n");
@@ -2175,6 +2517,10 @@ void ListEntitiesServicesArgument::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->name);
   buffer.encode_enum<enums::ServiceArgType>(2, this->type);
 }
+void ListEntitiesServicesArgument::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_enum_field(total_size, 1, this->type, false);
+}
 void ListEntitiesServicesArgument::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesServicesArgument {\n");
@@ -2218,6 +2564,13 @@ void ListEntitiesServicesResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<ListEntitiesServicesArgument>(3, it, true);
   }
 }
+void ListEntitiesServicesResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  for (const auto &it : this->args) {
+    ProtoSize::add_message_field<ListEntitiesServicesArgument>(total_size, 1, it);
+  }
+}
 void ListEntitiesServicesResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesServicesResponse {\n");
@@ -2310,6 +2663,25 @@ void ExecuteServiceArgument::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_string(9, it, true);
   }
 }
+void ExecuteServiceArgument::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool_field(total_size, 1, this->bool_, false);
+  ProtoSize::add_int32_field(total_size, 1, this->legacy_int, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->float_ != 0.0f, false);
+  ProtoSize::add_string_field(total_size, 1, this->string_, false);
+  ProtoSize::add_sint32_field(total_size, 1, this->int_, false);
+  for (const auto it : this->bool_array) {
+    ProtoSize::add_bool_field(total_size, 1, it, true);
+  }
+  for (const auto &it : this->int_array) {
+    ProtoSize::add_sint32_field(total_size, 1, it, true);
+  }
+  for (const auto &it : this->float_array) {
+    ProtoSize::add_fixed32_field(total_size, 1, it != 0.0f, true);
+  }
+  for (const auto &it : this->string_array) {
+    ProtoSize::add_string_field(total_size, 1, it, true);
+  }
+}
 void ExecuteServiceArgument::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ExecuteServiceArgument {\n");
@@ -2389,6 +2761,12 @@ void ExecuteServiceRequest::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<ExecuteServiceArgument>(2, it, true);
   }
 }
+void ExecuteServiceRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  for (const auto &it : this->args) {
+    ProtoSize::add_message_field<ExecuteServiceArgument>(total_size, 1, it);
+  }
+}
 void ExecuteServiceRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ExecuteServiceRequest {\n");
@@ -2438,6 +2816,12 @@ void ListEntitiesCameraResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(3, this->name);
   buffer.encode_string(4, this->unique_id);
 }
+void ListEntitiesCameraResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+}
 void ListEntitiesCameraResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesCameraResponse {\n");
@@ -2494,6 +2878,11 @@ void CameraImageResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->data);
   buffer.encode_bool(3, this->done);
 }
+void CameraImageResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->data, false);
+  ProtoSize::add_bool_field(total_size, 1, this->done, false);
+}
 void CameraImageResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("CameraImageResponse {\n");
@@ -2529,6 +2918,10 @@ void CameraImageRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(1, this->single);
   buffer.encode_bool(2, this->stream);
 }
+void CameraImageRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool_field(total_size, 1, this->single, false);
+  ProtoSize::add_bool_field(total_size, 1, this->stream, false);
+}
 void CameraImageRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("CameraImageRequest {\n");
@@ -2637,6 +3030,28 @@ void ListEntitiesClimateResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_enum<enums::ClimateSwingMode>(14, it, true);
   }
 }
+void ListEntitiesClimateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_current_temperature, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_two_point_target_temperature, false);
+  for (const auto &it : this->supported_modes) {
+    ProtoSize::add_enum_field(total_size, 1, it, true);
+  }
+  ProtoSize::add_fixed32_field(total_size, 1, this->visual_min_temperature != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->visual_max_temperature != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->visual_temperature_step != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_away, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_action, false);
+  for (const auto &it : this->supported_fan_modes) {
+    ProtoSize::add_enum_field(total_size, 1, it, true);
+  }
+  for (const auto &it : this->supported_swing_modes) {
+    ProtoSize::add_enum_field(total_size, 1, it, true);
+  }
+}
 void ListEntitiesClimateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesClimateResponse {\n");
@@ -2771,6 +3186,18 @@ void ClimateStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::ClimateFanMode>(9, this->fan_mode);
   buffer.encode_enum<enums::ClimateSwingMode>(10, this->swing_mode);
 }
+void ClimateStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_enum_field(total_size, 1, this->mode, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->current_temperature != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->target_temperature != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->target_temperature_low != 0.0f, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->target_temperature_high != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->away, false);
+  ProtoSize::add_enum_field(total_size, 1, this->action, false);
+  ProtoSize::add_enum_field(total_size, 1, this->fan_mode, false);
+  ProtoSize::add_enum_field(total_size, 1, this->swing_mode, false);
+}
 void ClimateStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ClimateStateResponse {\n");
@@ -2909,6 +3336,23 @@ void ClimateCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(14, this->has_swing_mode);
   buffer.encode_enum<enums::ClimateSwingMode>(15, this->swing_mode);
 }
+void ClimateCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed32_field(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_mode, false);
+  ProtoSize::add_enum_field(total_size, 1, this->mode, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_target_temperature, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->target_temperature != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_target_temperature_low, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->target_temperature_low != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_target_temperature_high, false);
+  ProtoSize::add_fixed32_field(total_size, 1, this->target_temperature_high != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_away, false);
+  ProtoSize::add_bool_field(total_size, 1, this->away, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_fan_mode, false);
+  ProtoSize::add_enum_field(total_size, 1, this->fan_mode, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_swing_mode, false);
+  ProtoSize::add_enum_field(total_size, 1, this->swing_mode, false);
+}
 void ClimateCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ClimateCommandRequest {\n");
@@ -2977,6 +3421,145 @@ void ClimateCommandRequest::dump_to(std::string &out) const {
   out.append("\n");
   out.append("}");
 }
+void ComponentStatsRequest::encode(ProtoWriteBuffer buffer) const {}
+void ComponentStatsRequest::calculate_size(uint32_t &total_size) const {}
+void ComponentStatsRequest::dump_to(std::string &out) const { out.append("ComponentStatsRequest {}"); }
+bool ComponentRuntimeStats::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 2: {
+      this->count = value.as_uint32();
+      return true;
+    }
+    case 3: {
+      this->total_us = value.as_uint64();
+      return true;
+    }
+    case 4: {
+      this->max_us = value.as_uint32();
+      return true;
+    }
+    case 5: {
+      this->p99_us = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool ComponentRuntimeStats::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 1: {
+      this->name = value.as_string();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ComponentRuntimeStats::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_string(1, this->name);
+  buffer.encode_uint32(2, this->count);
+  buffer.encode_uint64(3, this->total_us);
+  buffer.encode_uint32(4, this->max_us);
+  buffer.encode_uint32(5, this->p99_us);
+}
+void ComponentRuntimeStats::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->count, false);
+  ProtoSize::add_uint64_field(total_size, 1, this->total_us, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->max_us, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->p99_us, false);
+}
+void ComponentRuntimeStats::dump_to(std::string &out) const {
+  char buffer[64];
+  out.append("ComponentRuntimeStats {\n");
+  out.append("  name: ");
+  out.append("'").append(this->name).append("'");
+  out.append("\n");
+
+  out.append("  count: ");
+  sprintf(buffer, "%u", this->count);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  total_us: ");
+  sprintf(buffer, "%llu", this->total_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  max_us: ");
+  sprintf(buffer, "%u", this->max_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  p99_us: ");
+  sprintf(buffer, "%u", this->p99_us);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
+}
+bool ComponentStatsResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 1: {
+      this->setup.push_back(value.as_message<ComponentRuntimeStats>());
+      return true;
+    }
+    case 2: {
+      this->loop.push_back(value.as_message<ComponentRuntimeStats>());
+      return true;
+    }
+    case 3: {
+      this->scheduler.push_back(value.as_message<ComponentRuntimeStats>());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ComponentStatsResponse::encode(ProtoWriteBuffer buffer) const {
+  for (auto &it : this->setup) {
+    buffer.encode_message<ComponentRuntimeStats>(1, it, true);
+  }
+  for (auto &it : this->loop) {
+    buffer.encode_message<ComponentRuntimeStats>(2, it, true);
+  }
+  for (auto &it : this->scheduler) {
+    buffer.encode_message<ComponentRuntimeStats>(3, it, true);
+  }
+}
+void ComponentStatsResponse::calculate_size(uint32_t &total_size) const {
+  for (const auto &it : this->setup) {
+    ProtoSize::add_message_field<ComponentRuntimeStats>(total_size, 1, it);
+  }
+  for (const auto &it : this->loop) {
+    ProtoSize::add_message_field<ComponentRuntimeStats>(total_size, 1, it);
+  }
+  for (const auto &it : this->scheduler) {
+    ProtoSize::add_message_field<ComponentRuntimeStats>(total_size, 1, it);
+  }
+}
+void ComponentStatsResponse::dump_to(std::string &out) const {
+  char buffer[64];
+  out.append("ComponentStatsResponse {\n");
+  for (const auto &it : this->setup) {
+    out.append("  setup: ");
+    it.dump_to(out);
+    out.append("\n");
+  }
+
+  for (const auto &it : this->loop) {
+    out.append("  loop: ");
+    it.dump_to(out);
+    out.append("\n");
+  }
+
+  for (const auto &it : this->scheduler) {
+    out.append("  scheduler: ");
+    it.dump_to(out);
+    out.append("\n");
+  }
+  out.append("}");
+}
 
 }  // namespace api
 }  // namespace esphome
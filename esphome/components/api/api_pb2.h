@@ -91,6 +91,7 @@ class HelloRequest : public ProtoMessage {
  public:
   std::string client_info{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -102,6 +103,7 @@ class HelloResponse : public ProtoMessage {
   uint32_t api_version_minor{0};  // NOLINT
   std::string server_info{};      // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -112,6 +114,7 @@ class ConnectRequest : public ProtoMessage {
  public:
   std::string password{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -121,6 +124,7 @@ class ConnectResponse : public ProtoMessage {
  public:
   bool invalid_password{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -129,6 +133,7 @@ class ConnectResponse : public ProtoMessage {
 class DisconnectRequest : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -136,6 +141,7 @@ class DisconnectRequest : public ProtoMessage {
 class DisconnectResponse : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -143,6 +149,7 @@ class DisconnectResponse : public ProtoMessage {
 class PingRequest : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -150,6 +157,7 @@ class PingRequest : public ProtoMessage {
 class PingResponse : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -157,6 +165,7 @@ class PingResponse : public ProtoMessage {
 class DeviceInfoRequest : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -171,6 +180,7 @@ class DeviceInfoResponse : public ProtoMessage {
   std::string model{};             // NOLINT
   bool has_deep_sleep{false};      // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -180,6 +190,7 @@ class DeviceInfoResponse : public ProtoMessage {
 class ListEntitiesRequest : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -187,6 +198,7 @@ class ListEntitiesRequest : public ProtoMessage {
 class ListEntitiesDoneResponse : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -194,6 +206,7 @@ class ListEntitiesDoneResponse : public ProtoMessage {
 class SubscribeStatesRequest : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -207,6 +220,7 @@ class ListEntitiesBinarySensorResponse : public ProtoMessage {
   std::string device_class{};           // NOLINT
   bool is_status_binary_sensor{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -220,6 +234,7 @@ class BinarySensorStateResponse : public ProtoMessage {
   bool state{false};          // NOLINT
   bool missing_state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -237,6 +252,7 @@ class ListEntitiesCoverResponse : public ProtoMessage {
   bool supports_tilt{false};      // NOLINT
   std::string device_class{};     // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -252,6 +268,7 @@ class CoverStateResponse : public ProtoMessage {
   float tilt{0.0f};                           // NOLINT
   enums::CoverOperation current_operation{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -269,6 +286,7 @@ class CoverCommandRequest : public ProtoMessage {
   float tilt{0.0f};                            // NOLINT
   bool stop{false};                            // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -285,6 +303,7 @@ class ListEntitiesFanResponse : public ProtoMessage {
   bool supports_speed{false};        // NOLINT
   bool supports_direction{false};    // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -300,6 +319,7 @@ class FanStateResponse : public ProtoMessage {
   enums::FanSpeed speed{};          // NOLINT
   enums::FanDirection direction{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -318,6 +338,7 @@ class FanCommandRequest : public ProtoMessage {
   bool has_direction{false};        // NOLINT
   enums::FanDirection direction{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -338,6 +359,7 @@ class ListEntitiesLightResponse : public ProtoMessage {
   float max_mireds{0.0f};                  // NOLINT
   std::vector<std::string> effects{};      // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -357,6 +379,7 @@ class LightStateResponse : public ProtoMessage {
   float color_temperature{0.0f};  // NOLINT
   std::string effect{};           // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -386,6 +409,7 @@ class LightCommandRequest : public ProtoMessage {
   bool has_effect{false};             // NOLINT
   std::string effect{};               // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -405,6 +429,7 @@ class ListEntitiesSensorResponse : public ProtoMessage {
   int32_t accuracy_decimals{0};       // NOLINT
   bool force_update{false};           // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -418,6 +443,7 @@ class SensorStateResponse : public ProtoMessage {
   float state{0.0f};          // NOLINT
   bool missing_state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -433,6 +459,7 @@ class ListEntitiesSwitchResponse : public ProtoMessage {
   std::string icon{};         // NOLINT
   bool assumed_state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -445,6 +472,7 @@ class SwitchStateResponse : public ProtoMessage {
   uint32_t key{0};    // NOLINT
   bool state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -456,6 +484,7 @@ class SwitchCommandRequest : public ProtoMessage {
   uint32_t key{0};    // NOLINT
   bool state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -470,6 +499,7 @@ class ListEntitiesTextSensorResponse : public ProtoMessage {
   std::string unique_id{};  // NOLINT
   std::string icon{};       // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -482,6 +512,7 @@ class TextSensorStateResponse : public ProtoMessage {
   std::string state{};        // NOLINT
   bool missing_state{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -494,6 +525,7 @@ class SubscribeLogsRequest : public ProtoMessage {
   enums::LogLevel level{};  // NOLINT
   bool dump_config{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -506,15 +538,44 @@ class SubscribeLogsResponse : public ProtoMessage {
   std::string message{};    // NOLINT
   bool send_failed{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
   bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
+class SubscribeBinaryLogsRequest : public ProtoMessage {
+ public:
+  enums::LogLevel level{};  // NOLINT
+  bool dump_config{false};  // NOLINT
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
+  void dump_to(std::string &out) const override;
+
+ protected:
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+};
+class BinaryLogResponse : public ProtoMessage {
+ public:
+  enums::LogLevel level{};  // NOLINT
+  uint32_t tag{0};          // NOLINT
+  uint32_t line{0};         // NOLINT
+  uint32_t format{0};       // NOLINT
+  std::string args{};       // NOLINT
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
+  void dump_to(std::string &out) const override;
+
+ protected:
+  bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+};
 class SubscribeHomeassistantServicesRequest : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -524,6 +585,7 @@ class HomeassistantServiceMap : public ProtoMessage {
   std::string key{};    // NOLINT
   std::string value{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -537,6 +599,7 @@ class HomeassistantServiceResponse : public ProtoMessage {
   std::vector<HomeassistantServiceMap> variables{};      // NOLINT
   bool is_event{false};                                  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -546,6 +609,7 @@ class HomeassistantServiceResponse : public ProtoMessage {
 class SubscribeHomeAssistantStatesRequest : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -554,6 +618,7 @@ class SubscribeHomeAssistantStateResponse : public ProtoMessage {
  public:
   std::string entity_id{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -564,6 +629,7 @@ class HomeAssistantStateResponse : public ProtoMessage {
   std::string entity_id{};  // NOLINT
   std::string state{};      // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -572,6 +638,7 @@ class HomeAssistantStateResponse : public ProtoMessage {
 class GetTimeRequest : public ProtoMessage {
  public:
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -580,6 +647,7 @@ class GetTimeResponse : public ProtoMessage {
  public:
   uint32_t epoch_seconds{0};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -590,6 +658,7 @@ class ListEntitiesServicesArgument : public ProtoMessage {
   std::string name{};            // NOLINT
   enums::ServiceArgType type{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -602,6 +671,7 @@ class ListEntitiesServicesResponse : public ProtoMessage {
   uint32_t key{0};                                   // NOLINT
   std::vector<ListEntitiesServicesArgument> args{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -620,6 +690,7 @@ class ExecuteServiceArgument : public ProtoMessage {
   std::vector<float> float_array{};         // NOLINT
   std::vector<std::string> string_array{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -632,6 +703,7 @@ class ExecuteServiceRequest : public ProtoMessage {
   uint32_t key{0};                             // NOLINT
   std::vector<ExecuteServiceArgument> args{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -645,6 +717,7 @@ class ListEntitiesCameraResponse : public ProtoMessage {
   std::string name{};       // NOLINT
   std::string unique_id{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -657,6 +730,7 @@ class CameraImageResponse : public ProtoMessage {
   std::string data{};  // NOLINT
   bool done{false};    // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -669,6 +743,7 @@ class CameraImageRequest : public ProtoMessage {
   bool single{false};  // NOLINT
   bool stream{false};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -691,6 +766,7 @@ class ListEntitiesClimateResponse : public ProtoMessage {
   std::vector<enums::ClimateFanMode> supported_fan_modes{};      // NOLINT
   std::vector<enums::ClimateSwingMode> supported_swing_modes{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -711,6 +787,7 @@ class ClimateStateResponse : public ProtoMessage {
   enums::ClimateFanMode fan_mode{};      // NOLINT
   enums::ClimateSwingMode swing_mode{};  // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
@@ -735,12 +812,48 @@ class ClimateCommandRequest : public ProtoMessage {
   bool has_swing_mode{false};               // NOLINT
   enums::ClimateSwingMode swing_mode{};     // NOLINT
   void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
   void dump_to(std::string &out) const override;
 
  protected:
   bool decode_32bit(uint32_t field_id, Proto32Bit value) override;
   bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
 };
+class ComponentStatsRequest : public ProtoMessage {
+ public:
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
+  void dump_to(std::string &out) const override;
+
+ protected:
+};
+class ComponentRuntimeStats : public ProtoMessage {
+ public:
+  std::string name{};    // NOLINT
+  uint32_t count{0};     // NOLINT
+  uint64_t total_us{0};  // NOLINT
+  uint32_t max_us{0};    // NOLINT
+  uint32_t p99_us{0};    // NOLINT
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
+  void dump_to(std::string &out) const override;
+
+ protected:
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+  bool decode_varint(uint32_t field_id, ProtoVarInt value) override;
+};
+class ComponentStatsResponse : public ProtoMessage {
+ public:
+  std::vector<ComponentRuntimeStats> setup{};      // NOLINT
+  std::vector<ComponentRuntimeStats> loop{};       // NOLINT
+  std::vector<ComponentRuntimeStats> scheduler{};  // NOLINT
+  void encode(ProtoWriteBuffer buffer) const override;
+  void calculate_size(uint32_t &total_size) const override;
+  void dump_to(std::string &out) const override;
+
+ protected:
+  bool decode_length(uint32_t field_id, ProtoLengthDelimited value) override;
+};
 
 }  // namespace api
 }  // namespace esphome
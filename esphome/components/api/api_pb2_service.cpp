@@ -135,6 +135,9 @@ bool APIServerConnectionBase::send_text_sensor_state_response(const TextSensorSt
 bool APIServerConnectionBase::send_subscribe_logs_response(const SubscribeLogsResponse &msg) {
   return this->send_message_<SubscribeLogsResponse>(msg, 29);
 }
+bool APIServerConnectionBase::send_binary_log_response(const BinaryLogResponse &msg) {
+  return this->send_message_<BinaryLogResponse>(msg, 52);
+}
 bool APIServerConnectionBase::send_homeassistant_service_response(const HomeassistantServiceResponse &msg) {
   ESP_LOGVV(TAG, "send_homeassistant_service_response: %s", msg.dump().c_str());
   return this->send_message_<HomeassistantServiceResponse>(msg, 35);
@@ -184,6 +187,14 @@ bool APIServerConnectionBase::send_climate_state_response(const ClimateStateResp
 #endif
 #ifdef USE_CLIMATE
 #endif
+#ifdef USE_COMPONENT_PROFILER
+#endif
+#ifdef USE_COMPONENT_PROFILER
+bool APIServerConnectionBase::send_component_stats_response(const ComponentStatsResponse &msg) {
+  ESP_LOGVV(TAG, "send_component_stats_response: %s", msg.dump().c_str());
+  return this->send_message_<ComponentStatsResponse>(msg, 50);
+}
+#endif
 bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) {
   switch (msg_type) {
     case 1: {
@@ -352,6 +363,22 @@ bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
 #endif
       break;
     }
+    case 49: {
+#ifdef USE_COMPONENT_PROFILER
+      ComponentStatsRequest msg;
+      msg.decode(msg_data, msg_size);
+      ESP_LOGVV(TAG, "on_component_stats_request: %s", msg.dump().c_str());
+      this->on_component_stats_request(msg);
+#endif
+      break;
+    }
+    case 51: {
+      SubscribeBinaryLogsRequest msg;
+      msg.decode(msg_data, msg_size);
+      ESP_LOGVV(TAG, "on_subscribe_binary_logs_request: %s", msg.dump().c_str());
+      this->on_subscribe_binary_logs_request(msg);
+      break;
+    }
     default:
       return false;
   }
@@ -425,6 +452,17 @@ void APIServerConnection::on_subscribe_logs_request(const SubscribeLogsRequest &
   }
   this->subscribe_logs(msg);
 }
+void APIServerConnection::on_subscribe_binary_logs_request(const SubscribeBinaryLogsRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  this->subscribe_binary_logs(msg);
+}
 void APIServerConnection::on_subscribe_homeassistant_services_request(
     const SubscribeHomeassistantServicesRequest &msg) {
   if (!this->is_connection_setup()) {
@@ -547,6 +585,22 @@ void APIServerConnection::on_climate_command_request(const ClimateCommandRequest
   this->climate_command(msg);
 }
 #endif
+#ifdef USE_COMPONENT_PROFILER
+void APIServerConnection::on_component_stats_request(const ComponentStatsRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  ComponentStatsResponse ret = this->component_stats(msg);
+  if (!this->send_component_stats_response(ret)) {
+    this->on_fatal_error();
+  }
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
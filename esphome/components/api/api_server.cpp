@@ -16,6 +16,10 @@ namespace esphome {
 namespace api {
 
 static const char *TAG = "api";
+#ifdef USE_TICKLESS_LOOP
+/// How often loop() still runs while idle, for the keepalive and reboot timeouts.
+static const uint32_t API_IDLE_POLL_INTERVAL = 1000;
+#endif
 
 // APIServer
 void APIServer::setup() {
@@ -33,14 +37,23 @@ void APIServer::setup() {
         // ESP_LOGD(TAG, "New client connected from %s", client->remoteIP().toString().c_str());
         auto *a_this = (APIServer *) s;
         a_this->clients_.push_back(new APIConnection(client, a_this));
+        a_this->on_client_event();
       },
       this);
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
-    logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
+    logger::global_logger->add_on_log_callback(
+        [this](int level, const char *tag, const char *message) {
+          for (auto *c : this->clients_) {
+            if (!c->remove_)
+              c->send_log_message(level, tag, message);
+          }
+        },
+        true);
+    logger::global_logger->add_on_binary_log_callback([this](const logger::BinaryLogRecord &record) {
       for (auto *c : this->clients_) {
         if (!c->remove_)
-          c->send_log_message(level, tag, message);
+          c->send_binary_log_message(record);
       }
     });
   }
@@ -48,6 +61,14 @@ void APIServer::setup() {
 
   this->last_connected_ = millis();
 
+  if (this->batch_delay_.has_value()) {
+    this->set_interval("batch_stats", 60000, [this]() {
+      const StateBatchStats &stats = this->batch_stats_;
+      ESP_LOGV(TAG, "State batches: %u updates, %u coalesced, %u messages in %u writes, %u bytes saved",
+               stats.updates, stats.coalesced, stats.messages, stats.writes, stats.bytes_saved);
+    });
+  }
+
 #ifdef USE_ESP32_CAMERA
   if (esp32_camera::global_esp32_camera != nullptr) {
     esp32_camera::global_esp32_camera->add_image_callback([this](std::shared_ptr<esp32_camera::CameraImage> image) {
@@ -59,6 +80,9 @@ void APIServer::setup() {
 #endif
 }
 void APIServer::loop() {
+#ifdef USE_TICKLESS_LOOP
+  this->client_event_ = false;
+#endif
   // Partition clients into remove and active
   auto new_end =
       std::partition(this->clients_.begin(), this->clients_.end(), [](APIConnection *conn) { return !conn->remove_; });
@@ -90,10 +114,39 @@ void APIServer::loop() {
       this->status_clear_warning();
     }
   }
+
+#ifdef USE_TICKLESS_LOOP
+  for (auto *client : this->clients_) {
+    if (!client->is_idle_())
+      return;
+  }
+  this->set_timeout("idle", API_IDLE_POLL_INTERVAL, [this]() { this->enable_loop(); });
+  this->disable_loop();
+  // An event after this point enables the loop again by itself
+  if (this->client_event_)
+    this->enable_loop();
+#endif
+}
+std::shared_ptr<const std::vector<uint8_t>> APIServer::get_list_entities_cache() const {
+  if (this->list_entities_cache_generation_ != Nameable::get_key_generation())
+    return nullptr;
+  return this->list_entities_cache_;
+}
+void APIServer::store_list_entities_cache(std::shared_ptr<const std::vector<uint8_t>> cache) {
+  this->list_entities_cache_ = std::move(cache);
+  this->list_entities_cache_generation_ = Nameable::get_key_generation();
+}
+void APIServer::on_client_event() {
+#ifdef USE_TICKLESS_LOOP
+  this->client_event_ = true;
+  this->enable_loop();
+#endif
 }
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network_get_address().c_str(), this->port_);
+  if (this->batch_delay_.has_value())
+    ESP_LOGCONFIG(TAG, "  State Batch Delay: %u ms", *this->batch_delay_);
 }
 bool APIServer::uses_password() const { return !this->password_.empty(); }
 bool APIServer::check_password(const std::string &password) const {
@@ -130,7 +183,7 @@ void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool s
   if (obj->is_internal())
     return;
   for (auto *c : this->clients_)
-    c->send_binary_sensor_state(obj, state);
+    c->send_state_update(StateUpdateType::BINARY_SENSOR, obj);
 }
 #endif
 
@@ -139,7 +192,7 @@ void APIServer::on_cover_update(cover::Cover *obj) {
   if (obj->is_internal())
     return;
   for (auto *c : this->clients_)
-    c->send_cover_state(obj);
+    c->send_state_update(StateUpdateType::COVER, obj);
 }
 #endif
 
@@ -148,7 +201,7 @@ void APIServer::on_fan_update(fan::FanState *obj) {
   if (obj->is_internal())
     return;
   for (auto *c : this->clients_)
-    c->send_fan_state(obj);
+    c->send_state_update(StateUpdateType::FAN, obj);
 }
 #endif
 
@@ -157,7 +210,7 @@ void APIServer::on_light_update(light::LightState *obj) {
   if (obj->is_internal())
     return;
   for (auto *c : this->clients_)
-    c->send_light_state(obj);
+    c->send_state_update(StateUpdateType::LIGHT, obj);
 }
 #endif
 
@@ -166,7 +219,7 @@ void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
   if (obj->is_internal())
     return;
   for (auto *c : this->clients_)
-    c->send_sensor_state(obj, state);
+    c->send_state_update(StateUpdateType::SENSOR, obj);
 }
 #endif
 
@@ -175,7 +228,7 @@ void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
   if (obj->is_internal())
     return;
   for (auto *c : this->clients_)
-    c->send_switch_state(obj, state);
+    c->send_state_update(StateUpdateType::SWITCH, obj);
 }
 #endif
 
@@ -184,7 +237,7 @@ void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, std::string
   if (obj->is_internal())
     return;
   for (auto *c : this->clients_)
-    c->send_text_sensor_state(obj, state);
+    c->send_state_update(StateUpdateType::TEXT_SENSOR, obj);
 }
 #endif
 
@@ -193,7 +246,7 @@ void APIServer::on_climate_update(climate::Climate *obj) {
   if (obj->is_internal())
     return;
   for (auto *c : this->clients_)
-    c->send_climate_state(obj);
+    c->send_state_update(StateUpdateType::CLIMATE, obj);
 }
 #endif
 
@@ -10,7 +10,10 @@
 #include "list_entities.h"
 #include "subscribe_state.h"
 #include "homeassistant_service.h"
+#include "recv_buffer.h"
 #include "user_services.h"
+#include <memory>
+#include <vector>
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <AsyncTCP.h>
@@ -22,6 +25,20 @@
 namespace esphome {
 namespace api {
 
+/// Counters of the state updates sent in batches, see APIServer::set_batch_delay().
+struct StateBatchStats {
+  /// Number of state updates queued.
+  uint32_t updates{0};
+  /// Number of queued updates that were replaced by a newer state of the same entity before being sent.
+  uint32_t coalesced{0};
+  /// Number of state messages sent in batches.
+  uint32_t messages{0};
+  /// Number of writes the batches were sent with.
+  uint32_t writes{0};
+  /// Number of bytes the coalesced updates would have needed.
+  uint32_t bytes_saved{0};
+};
+
 class APIServer : public Component, public Controller {
  public:
   APIServer();
@@ -36,6 +53,36 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  /** Send state updates in batches instead of one by one.
+   *
+   * State updates are queued for up to batch_delay ms (0 = until the next loop iteration) and then sent to each
+   * client in a single write, with only the latest state of entities that changed several times in between.
+   */
+  void set_batch_delay(uint32_t batch_delay) { this->batch_delay_ = batch_delay; }
+  const optional<uint32_t> &get_batch_delay() const { return this->batch_delay_; }
+  StateBatchStats &get_batch_stats() { return this->batch_stats_; }
+  /** Resume loop() after it went idle because no client had any work.
+   *
+   * Called when a client connects, sends data or disconnects (from the TCP stack) and when a state update is queued.
+   */
+  void on_client_event();
+  /** Encode the ListEntities responses only once and send the same bytes to every client that lists the entities.
+   *
+   * The cache is built by the first client that lists the entities and rebuilt when an entity is renamed. Other
+   * changes to the entity descriptions after that (not their states) aren't seen by clients anymore.
+   */
+  void set_list_entities_cache(bool list_entities_cache) { this->list_entities_cache_enabled_ = list_entities_cache; }
+  bool is_list_entities_cache_enabled() const { return this->list_entities_cache_enabled_; }
+  /// Disconnect clients that send a message larger than this many bytes.
+  void set_max_message_size(uint32_t max_message_size) { this->max_message_size_ = max_message_size; }
+  uint32_t get_max_message_size() const { return this->max_message_size_; }
+  /** The frames of all ListEntities responses up to and including ListEntitiesDoneResponse.
+   *
+   * nullptr until a client stored it, and again after an entity was renamed. Connections keep a reference to the
+   * cache they sent, because the TCP stack sends straight from it.
+   */
+  std::shared_ptr<const std::vector<uint8_t>> get_list_entities_cache() const;
+  void store_list_entities_cache(std::shared_ptr<const std::vector<uint8_t>> cache);
   void handle_disconnect(APIConnection *conn);
 #ifdef USE_BINARY_SENSOR
   void on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) override;
@@ -83,7 +130,18 @@ class APIServer : public Component, public Controller {
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
   uint32_t last_connected_{0};
+  optional<uint32_t> batch_delay_{};
+  StateBatchStats batch_stats_;
+  bool list_entities_cache_enabled_{false};
+  uint32_t max_message_size_{API_DEFAULT_MAX_MESSAGE_SIZE};
+  std::shared_ptr<const std::vector<uint8_t>> list_entities_cache_;
+  /// Nameable::get_key_generation() when the cache was stored.
+  uint32_t list_entities_cache_generation_{0};
   std::vector<APIConnection *> clients_;
+#ifdef USE_TICKLESS_LOOP
+  /// Set by on_client_event(), so that an event during loop() isn't lost when loop() goes idle.
+  volatile bool client_event_{false};
+#endif
   std::string password_;
   std::vector<HomeAssistantStateSubscription> state_subs_;
   std::vector<UserServiceDescriptor *> user_services_;
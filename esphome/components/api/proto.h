@@ -6,6 +6,98 @@
 namespace esphome {
 namespace api {
 
+/** Helpers for calculating the encoded size of a message before encoding it.
+ *
+ * Each add_*_field() mirrors the matching ProtoWriteBuffer::encode_*() method, including skipping default values
+ * unless force is set. field_id_size is the size of the encoded field key, which the code generator knows.
+ */
+class ProtoSize {
+ public:
+  static uint32_t varint(uint32_t value) {
+    if (value < (1UL << 7))
+      return 1;
+    if (value < (1UL << 14))
+      return 2;
+    if (value < (1UL << 21))
+      return 3;
+    if (value < (1UL << 28))
+      return 4;
+    return 5;
+  }
+  static uint32_t varint(uint64_t value) {
+    uint32_t size = 1;
+    while (value >= 0x80) {
+      value >>= 7;
+      size++;
+    }
+    return size;
+  }
+
+  static void add_uint32_field(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_uint64_field(uint32_t &total_size, uint32_t field_id_size, uint64_t value, bool force) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_int32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force) {
+    if (value < 0) {
+      // negative int32 is always 10 byte long
+      add_uint64_field(total_size, field_id_size, static_cast<uint64_t>(static_cast<int64_t>(value)), force);
+      return;
+    }
+    add_uint32_field(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_int64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force) {
+    add_uint64_field(total_size, field_id_size, static_cast<uint64_t>(value), force);
+  }
+  static void add_sint32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force) {
+    add_uint32_field(total_size, field_id_size, value < 0 ? ~(value << 1) : value << 1, force);
+  }
+  static void add_sint64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force) {
+    const uint64_t uvalue = static_cast<uint64_t>(value) << 1;
+    add_uint64_field(total_size, field_id_size, value < 0 ? ~uvalue : uvalue, force);
+  }
+  static void add_bool_field(uint32_t &total_size, uint32_t field_id_size, bool value, bool force) {
+    if (!value && !force)
+      return;
+    total_size += field_id_size + 1;
+  }
+  template<typename T>
+  static void add_enum_field(uint32_t &total_size, uint32_t field_id_size, T value, bool force) {
+    add_uint32_field(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  /// For fixed32, sfixed32 and float fields.
+  static void add_fixed32_field(uint32_t &total_size, uint32_t field_id_size, bool is_nonzero, bool force) {
+    if (!is_nonzero && !force)
+      return;
+    total_size += field_id_size + 4;
+  }
+  /// For fixed64, sfixed64 and double fields.
+  static void add_fixed64_field(uint32_t &total_size, uint32_t field_id_size, bool is_nonzero, bool force) {
+    if (!is_nonzero && !force)
+      return;
+    total_size += field_id_size + 8;
+  }
+  static void add_string_field(uint32_t &total_size, uint32_t field_id_size, size_t len, bool force) {
+    if (len == 0 && !force)
+      return;
+    total_size += field_id_size + varint(static_cast<uint32_t>(len)) + len;
+  }
+  static void add_string_field(uint32_t &total_size, uint32_t field_id_size, const std::string &value, bool force) {
+    add_string_field(total_size, field_id_size, value.size(), force);
+  }
+  /// Nested messages are always encoded, even when empty.
+  template<class C> static void add_message_field(uint32_t &total_size, uint32_t field_id_size, const C &value) {
+    uint32_t nested_size = 0;
+    value.calculate_size(nested_size);
+    total_size += field_id_size + varint(nested_size) + nested_size;
+  }
+};
+
 /// Representation of a VarInt - in ProtoBuf should be 64bit but we only use 32bit
 class ProtoVarInt {
  public:
@@ -62,21 +154,20 @@ class ProtoVarInt {
     else
       return static_cast<int64_t>(this->value_ >> 1);
   }
-  void encode(std::vector<uint8_t> &out) {
-    uint32_t val = this->value_;
-    if (val <= 0x7F) {
-      out.push_back(val);
-      return;
-    }
-    while (val) {
-      uint8_t temp = val & 0x7F;
+  void encode(std::vector<uint8_t> &out) const {
+    const size_t pos = out.size();
+    out.resize(pos + ProtoSize::varint(this->value_));
+    this->encode_to(&out[pos]);
+  }
+  /// Write the VarInt to out, which needs space for ProtoSize::varint() bytes. Returns the end of the written data.
+  uint8_t *encode_to(uint8_t *out) const {
+    uint64_t val = this->value_;
+    while (val >= 0x80) {
+      *out++ = (val & 0x7F) | 0x80;
       val >>= 7;
-      if (val) {
-        out.push_back(temp | 0x80);
-      } else {
-        out.push_back(temp);
-      }
     }
+    *out++ = val;
+    return out;
   }
 
  protected:
@@ -151,11 +242,10 @@ class ProtoWriteBuffer {
     this->encode_field_raw(field_id, 2);
     this->encode_varint_raw(len);
     auto *data = reinterpret_cast<const uint8_t *>(string);
-    for (size_t i = 0; i < len; i++)
-      this->write(data[i]);
+    this->buffer_->insert(this->buffer_->end(), data, data + len);
   }
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
-    this->encode_string(field_id, value.data(), value.size());
+    this->encode_string(field_id, value.data(), value.size(), force);
   }
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
@@ -183,10 +273,13 @@ class ProtoWriteBuffer {
       return;
 
     this->encode_field_raw(field_id, 5);
-    this->write((value >> 0) & 0xFF);
-    this->write((value >> 8) & 0xFF);
-    this->write((value >> 16) & 0xFF);
-    this->write((value >> 24) & 0xFF);
+    const size_t pos = this->buffer_->size();
+    this->buffer_->resize(pos + 4);
+    uint8_t *data = &(*this->buffer_)[pos];
+    data[0] = (value >> 0) & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
   }
   template<typename T> void encode_enum(uint32_t field_id, T value, bool force = false) {
     this->encode_uint32(field_id, static_cast<uint32_t>(value), force);
@@ -200,7 +293,7 @@ class ProtoWriteBuffer {
       uint32_t raw;
     } val{};
     val.value = value;
-    this->encode_fixed32(field_id, val.raw);
+    this->encode_fixed32(field_id, val.raw, force);
   }
   void encode_int32(uint32_t field_id, int32_t value, bool force = false) {
     if (value < 0) {
@@ -221,17 +314,17 @@ class ProtoWriteBuffer {
       uvalue = value << 1;
     this->encode_uint32(field_id, uvalue, force);
   }
+  void encode_sint64(uint32_t field_id, int64_t value, bool force = false) {
+    const uint64_t uvalue = static_cast<uint64_t>(value) << 1;
+    this->encode_uint64(field_id, value < 0 ? ~uvalue : uvalue, force);
+  }
   template<class C> void encode_message(uint32_t field_id, const C &value, bool force = false) {
     this->encode_field_raw(field_id, 2);
-    size_t begin = this->buffer_->size();
-
+    // The size is calculated up front, so the nested message doesn't have to be moved after encoding it
+    uint32_t nested_size = 0;
+    value.calculate_size(nested_size);
+    this->encode_varint_raw(nested_size);
     value.encode(*this);
-
-    const uint32_t nested_length = this->buffer_->size() - begin;
-    // add size varint
-    std::vector<uint8_t> var;
-    ProtoVarInt(nested_length).encode(var);
-    this->buffer_->insert(this->buffer_->begin() + begin, var.begin(), var.end());
   }
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
@@ -242,6 +335,8 @@ class ProtoWriteBuffer {
 class ProtoMessage {
  public:
   virtual void encode(ProtoWriteBuffer buffer) const = 0;
+  /// Add the encoded size of this message (as encode() would write it) to total_size.
+  virtual void calculate_size(uint32_t &total_size) const = 0;
   void decode(const uint8_t *buffer, size_t length);
   std::string dump() const;
   virtual void dump_to(std::string &out) const = 0;
@@ -263,12 +358,15 @@ class ProtoService {
   virtual void on_fatal_error() = 0;
   virtual void on_unauthenticated_access() = 0;
   virtual void on_no_setup_connection() = 0;
-  virtual ProtoWriteBuffer create_buffer() = 0;
+  /// Create a buffer to encode a message into, with enough space reserved for a message of reserve_size bytes.
+  virtual ProtoWriteBuffer create_buffer(uint32_t reserve_size) = 0;
   virtual bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) = 0;
   virtual bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) = 0;
 
   template<class C> bool send_message_(const C &msg, uint32_t message_type) {
-    auto buffer = this->create_buffer();
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    auto buffer = this->create_buffer(msg_size);
     msg.encode(buffer);
     return this->send_buffer(buffer, message_type);
   }
@@ -0,0 +1,59 @@
+#include "recv_buffer.h"
+#include "proto.h"
+
+namespace esphome {
+namespace api {
+
+void APIRecvBuffer::append(const uint8_t *data, size_t len) {
+  if (this->read_pos_ == this->buffer_.size()) {
+    // Everything parsed, start over at the beginning without moving anything
+    this->buffer_.clear();
+    this->read_pos_ = 0;
+  }
+  this->buffer_.insert(this->buffer_.end(), data, data + len);
+}
+
+APIFrameResult APIRecvBuffer::next_frame(APIFrame *frame) {
+  const size_t size = this->buffer_.size();
+  size_t i = this->read_pos_;
+  if (i == size)
+    return APIFrameResult::INCOMPLETE;
+  if (this->buffer_[i] != 0x00)
+    return APIFrameResult::INVALID_PREAMBLE;
+  i++;
+
+  // Neither the size nor the type varint can be longer than 5 bytes
+  uint32_t consumed;
+  auto msg_size_varint = ProtoVarInt::parse(this->buffer_.data() + i, size - i, &consumed);
+  if (!msg_size_varint.has_value())
+    return size - i >= 5 ? APIFrameResult::TOO_LARGE : APIFrameResult::INCOMPLETE;
+  i += consumed;
+  if (msg_size_varint->as_uint64() > this->max_message_size_)
+    return APIFrameResult::TOO_LARGE;
+  const uint32_t msg_size = msg_size_varint->as_uint32();
+
+  auto msg_type_varint = ProtoVarInt::parse(this->buffer_.data() + i, size - i, &consumed);
+  if (!msg_type_varint.has_value())
+    return size - i >= 5 ? APIFrameResult::TOO_LARGE : APIFrameResult::INCOMPLETE;
+  i += consumed;
+
+  if (size - i < msg_size)
+    return APIFrameResult::INCOMPLETE;
+
+  frame->type = msg_type_varint->as_uint32();
+  frame->size = msg_size;
+  frame->data = this->buffer_.data() + i;
+  this->read_pos_ = i + msg_size;
+  return APIFrameResult::OK;
+}
+
+void APIRecvBuffer::compact() {
+  if (this->read_pos_ == 0)
+    return;
+  // Only the start of an incomplete frame is left, if anything
+  this->buffer_.erase(this->buffer_.begin(), this->buffer_.begin() + this->read_pos_);
+  this->read_pos_ = 0;
+}
+
+}  // namespace api
+}  // namespace esphome
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace api {
+
+/// Default for APIRecvBuffer::set_max_message_size(), the api 'max_message_size' option.
+static const uint32_t API_DEFAULT_MAX_MESSAGE_SIZE = 4096;
+
+enum class APIFrameResult {
+  /// A complete frame was parsed.
+  OK,
+  /// More data is needed for the next frame.
+  INCOMPLETE,
+  /// The frame doesn't start with the 0x00 preamble.
+  INVALID_PREAMBLE,
+  /// The frame announces a message larger than the maximum message size, or its header varints are too long.
+  TOO_LARGE,
+};
+
+/// A received message, pointing into the receive buffer.
+struct APIFrame {
+  uint32_t type;
+  uint32_t size;
+  uint8_t *data;
+};
+
+/** Receive buffer for the native API that parses frames in place.
+ *
+ * Received data is appended at the end and frames are parsed from a read position, so that messages can be decoded
+ * directly from the buffer. The consumed bytes are only dropped in compact(), once per batch of parsed frames,
+ * instead of moving the rest of the buffer after every message.
+ */
+class APIRecvBuffer {
+ public:
+  /** Reject messages larger than this with APIFrameResult::TOO_LARGE, and the client is then disconnected.
+   *
+   * This bounds the memory a connection can use for an incomplete message.
+   */
+  void set_max_message_size(uint32_t max_message_size) { this->max_message_size_ = max_message_size; }
+  uint32_t get_max_message_size() const { return this->max_message_size_; }
+
+  void append(const uint8_t *data, size_t len);
+
+  /** Parse the next frame at the read position.
+   *
+   * On success, the read position is advanced past the frame. frame->data stays valid until the next call to
+   * append() or compact().
+   */
+  APIFrameResult next_frame(APIFrame *frame);
+
+  /// Drop all bytes before the read position.
+  void compact();
+
+  /// The number of received bytes that haven't been parsed yet.
+  size_t available() const { return this->buffer_.size() - this->read_pos_; }
+
+ protected:
+  std::vector<uint8_t> buffer_;
+  size_t read_pos_{0};
+  uint32_t max_message_size_{API_DEFAULT_MAX_MESSAGE_SIZE};
+};
+
+}  // namespace api
+}  // namespace esphome
@@ -19,6 +19,8 @@ class ComponentIterator {
 
   void begin();
   void advance();
+  /// Whether begin() was called and the iteration hasn't finished yet.
+  bool is_running() const { return this->state_ != IteratorState::NONE; }
   virtual bool on_begin();
 #ifdef USE_BINARY_SENSOR
   virtual bool on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) = 0;
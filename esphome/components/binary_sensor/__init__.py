@@ -293,6 +293,7 @@ def register_binary_sensor(var, config):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_binary_sensor(var))
     yield setup_binary_sensor_core_(var, config)
+    cg.add_object_id_hash(var, config[CONF_NAME])
 
 
 @coroutine
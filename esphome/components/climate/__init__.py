@@ -92,6 +92,7 @@ def register_climate(var, config):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_climate(var))
     yield setup_climate_core_(var, config)
+    cg.add_object_id_hash(var, config[CONF_NAME])
 
 
 CLIMATE_CONTROL_ACTION_SCHEMA = cv.Schema({
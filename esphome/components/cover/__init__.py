@@ -72,6 +72,7 @@ def register_cover(var, config):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_cover(var))
     yield setup_cover_core_(var, config)
+    cg.add_object_id_hash(var, config[CONF_NAME])
 
 
 COVER_ACTION_SCHEMA = maybe_simple_id({
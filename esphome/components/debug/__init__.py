@@ -1,17 +1,37 @@
 import esphome.config_validation as cv
 import esphome.codegen as cg
 from esphome.const import CONF_ID
+from esphome.core import CORE, coroutine_with_priority
+from esphome.cpp_generator import MockObjClass
 
 CODEOWNERS = ['@OttoWinter']
 DEPENDENCIES = ['logger']
 
+CONF_PROFILER = 'profiler'
+
 debug_ns = cg.esphome_ns.namespace('debug')
 DebugComponent = debug_ns.class_('DebugComponent', cg.Component)
 CONFIG_SCHEMA = cv.Schema({
     cv.GenerateID(): cv.declare_id(DebugComponent),
+    cv.Optional(CONF_PROFILER, default=False): cv.boolean,
 }).extend(cv.COMPONENT_SCHEMA)
 
 
+@coroutine_with_priority(-1000.0)
+def set_component_sources():
+    # Runs after all components have been declared, so every component pointer is known here
+    for id_, var in CORE.variables.items():
+        if getattr(var, 'op', None) != '->':
+            continue
+        if not isinstance(id_.type, MockObjClass) or not id_.type.inherits_from(cg.Component):
+            continue
+        cg.add(var.set_component_source(id_.id))
+
+
 def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     yield cg.register_component(var, config)
+
+    if config[CONF_PROFILER]:
+        cg.add_define('USE_COMPONENT_PROFILER')
+        CORE.add_job(set_component_sources)
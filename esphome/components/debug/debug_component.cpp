@@ -3,6 +3,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/version.h"
+#include "esphome/core/application.h"
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <rom/rtc.h>
@@ -197,6 +198,35 @@ void DebugComponent::dump_config() {
   ESP_LOGD(TAG, "Reset Info: %s", ESP.getResetInfo().c_str());
 #endif
 }
+#ifdef USE_COMPONENT_PROFILER
+static void log_runtime_stats(const char *kind, const char *source, const char *name, const RuntimeStats &stats) {
+  if (stats.get_count() == 0)
+    return;
+  ESP_LOGD(TAG, "  %s %s%s%s: %u calls, avg=%uus max=%uus p99<=%uus", kind, source, name[0] != '\0' ? "/" : "", name,
+           stats.get_count(), static_cast<uint32_t>(stats.get_total_us() / stats.get_count()), stats.get_max_us(),
+           stats.get_p99_us());
+}
+static void log_profiler_stats() {
+  ESP_LOGD(TAG, "Component runtime:");
+  for (auto *component : App.get_components()) {
+    log_runtime_stats("setup", component->get_component_source(), "", component->get_setup_stats());
+    log_runtime_stats("loop", component->get_component_source(), "", component->get_loop_stats());
+  }
+  for (auto &it : App.scheduler.get_callback_stats()) {
+    const char *source = it.component != nullptr ? it.component->get_component_source() : "<unknown>";
+    log_runtime_stats("scheduler", source, it.name.c_str(), it.stats);
+  }
+}
+#endif
+void DebugComponent::setup() {
+  this->set_interval("loop_stats", 60000, []() {
+    ESP_LOGD(TAG, "Main loop: %.1f iterations/s, %.1f%% idle", App.get_loops_per_second(),
+             App.get_idle_fraction() * 100.0f);
+#ifdef USE_COMPONENT_PROFILER
+    log_profiler_stats();
+#endif
+  });
+}
 void DebugComponent::loop() {
   uint32_t new_free_heap = ESP.getFreeHeap();
   if (new_free_heap < this->free_heap_ / 2) {
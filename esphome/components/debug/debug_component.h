@@ -7,6 +7,7 @@ namespace debug {
 
 class DebugComponent : public Component {
  public:
+  void setup() override;
   void loop() override;
   float get_setup_priority() const override;
   void dump_config() override;
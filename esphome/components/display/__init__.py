@@ -2,7 +2,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import core, automation
 from esphome.automation import maybe_simple_id
-from esphome.const import CONF_ID, CONF_LAMBDA, CONF_PAGES, CONF_ROTATION
+from esphome.const import CONF_FRAME_DIFF, CONF_ID, CONF_LAMBDA, CONF_PAGES, CONF_ROTATION
 from esphome.core import coroutine, coroutine_with_priority
 
 IS_PLATFORM_COMPONENT = True
@@ -37,6 +37,7 @@ BASIC_DISPLAY_SCHEMA = cv.Schema({
 
 FULL_DISPLAY_SCHEMA = BASIC_DISPLAY_SCHEMA.extend({
     cv.Optional(CONF_ROTATION): validate_rotation,
+    cv.Optional(CONF_FRAME_DIFF, default=False): cv.boolean,
     cv.Optional(CONF_PAGES): cv.All(cv.ensure_list({
         cv.GenerateID(): cv.declare_id(DisplayPage),
         cv.Required(CONF_LAMBDA): cv.lambda_,
@@ -48,6 +49,8 @@ FULL_DISPLAY_SCHEMA = BASIC_DISPLAY_SCHEMA.extend({
 def setup_display_core_(var, config):
     if CONF_ROTATION in config:
         cg.add(var.set_rotation(DISPLAY_ROTATIONS[config[CONF_ROTATION]]))
+    if config.get(CONF_FRAME_DIFF, False):
+        cg.add(var.set_frame_diff(True))
     if CONF_PAGES in config:
         pages = []
         for conf in config[CONF_PAGES]:
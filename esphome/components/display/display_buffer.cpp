@@ -11,6 +11,11 @@ static const char *TAG = "display";
 const Color COLOR_OFF(0, 0, 0, 0);
 const Color COLOR_ON(1, 1, 1, 1);
 
+/// Beyond this many dirty regions they're merged, starting another transfer costs more than the pixels it saves.
+static const size_t MAX_DIRTY_REGIONS = 4;
+/// Width and height of the tiles the frame diff compares, a multiple of 8 for DISPLAY_BUFFER_LAYOUT_PAGES.
+static const int FRAME_DIFF_TILE_SIZE = 16;
+
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   this->buffer_ = new uint8_t[buffer_length];
   if (this->buffer_ == nullptr) {
@@ -44,26 +49,46 @@ int DisplayBuffer::get_height() {
   }
 }
 void DisplayBuffer::set_rotation(DisplayRotation rotation) { this->rotation_ = rotation; }
-void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
+void HOT DisplayBuffer::rotate_point_(int *x, int *y) {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_0_DEGREES:
       break;
     case DISPLAY_ROTATION_90_DEGREES:
-      std::swap(x, y);
-      x = this->get_width_internal() - x - 1;
+      std::swap(*x, *y);
+      *x = this->get_width_internal() - *x - 1;
       break;
     case DISPLAY_ROTATION_180_DEGREES:
-      x = this->get_width_internal() - x - 1;
-      y = this->get_height_internal() - y - 1;
+      *x = this->get_width_internal() - *x - 1;
+      *y = this->get_height_internal() - *y - 1;
       break;
     case DISPLAY_ROTATION_270_DEGREES:
-      std::swap(x, y);
-      y = this->get_height_internal() - y - 1;
+      std::swap(*x, *y);
+      *y = this->get_height_internal() - *y - 1;
       break;
   }
+}
+void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
+  this->rotate_point_(&x, &y);
+  this->mark_dirty_(x, y, x, y);
   this->draw_absolute_pixel_internal(x, y, color);
   App.feed_wdt();
 }
+void HOT DisplayBuffer::blend_pixel_at(int x, int y, Color color, uint8_t alpha) {
+  if (alpha == 0)
+    return;
+  if (alpha == 255) {
+    this->draw_pixel_at(x, y, color);
+    return;
+  }
+  this->rotate_point_(&x, &y);
+  this->mark_dirty_(x, y, x, y);
+  this->blend_absolute_pixel_internal(x, y, color, alpha);
+  App.feed_wdt();
+}
+void HOT DisplayBuffer::blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha) {
+  if (alpha >= 128)
+    this->draw_absolute_pixel_internal(x, y, color);
+}
 void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, Color color) {
   const int32_t dx = abs(x2 - x1), sx = x1 < x2 ? 1 : -1;
   const int32_t dy = -abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
@@ -85,14 +110,10 @@ void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, Color color) {
   }
 }
 void HOT DisplayBuffer::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
+  this->filled_rectangle(x, y, width, 1, color);
 }
 void HOT DisplayBuffer::vertical_line(int x, int y, int height, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
+  this->filled_rectangle(x, y, 1, height, color);
 }
 void DisplayBuffer::rectangle(int x1, int y1, int width, int height, Color color) {
   this->horizontal_line(x1, y1, width, color);
@@ -100,12 +121,66 @@ void DisplayBuffer::rectangle(int x1, int y1, int width, int height, Color color
   this->vertical_line(x1, y1, height, color);
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
-void DisplayBuffer::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+void HOT DisplayBuffer::filled_rectangle(int x1, int y1, int width, int height, Color color) {
+  // clip to the display, x2 and y2 are exclusive
+  int x2 = std::min(x1 + width, this->get_width());
+  int y2 = std::min(y1 + height, this->get_height());
+  x1 = std::max(x1, 0);
+  y1 = std::max(y1, 0);
+  if (x1 >= x2 || y1 >= y2)
+    return;
+
+  // rotate the corners like draw_pixel_at() does
+  const int w = this->get_width_internal();
+  const int h = this->get_height_internal();
+  int ax1, ay1, ax2, ay2;
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_90_DEGREES:
+      ax1 = w - y2;
+      ax2 = w - y1;
+      ay1 = x1;
+      ay2 = x2;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      ax1 = w - x2;
+      ax2 = w - x1;
+      ay1 = h - y2;
+      ay2 = h - y1;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      ax1 = y1;
+      ax2 = y2;
+      ay1 = h - x2;
+      ay2 = h - x1;
+      break;
+    case DISPLAY_ROTATION_0_DEGREES:
+    default:
+      ax1 = x1;
+      ax2 = x2;
+      ay1 = y1;
+      ay2 = y2;
+      break;
+  }
+  this->mark_dirty_(ax1, ay1, ax2 - 1, ay2 - 1);
+  this->fill_rect_internal(ax1, ay1, ax2 - ax1, ay2 - ay1, color);
+  App.feed_wdt();
+}
+void HOT DisplayBuffer::fill_rect_internal(int x1, int y1, int width, int height, Color color) {
+  for (int y = y1; y < y1 + height; y++) {
+    for (int x = x1; x < x1 + width; x++)
+      this->draw_absolute_pixel_internal(x, y, color);
   }
 }
+void HOT DisplayBuffer::blit_bitmap_internal(int x1, int y1, const uint8_t *data, int width, int height,
+                                             Color color) {
+  for_each_bitmap_pixel(data, width, height, [this, x1, y1, color](int x, int y) {
+    this->draw_absolute_pixel_internal(x1 + x, y1 + y, color);
+  });
+}
+bool DisplayBuffer::can_blit_(int x, int y, int width, int height) {
+  return this->rotation_ == DISPLAY_ROTATION_0_DEGREES && x >= 0 && y >= 0 && x + width <= this->get_width_internal() &&
+         y + height <= this->get_height_internal();
+}
 void HOT DisplayBuffer::circle(int center_x, int center_xy, int radius, Color color) {
   int dx = -radius;
   int dy = 0;
@@ -171,9 +246,7 @@ void DisplayBuffer::print(int x, int y, Font *font, Color color, TextAlign align
       ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
       if (!font->get_glyphs().empty()) {
         uint8_t glyph_width = font->get_glyphs()[0].width_;
-        for (int glyph_x = 0; glyph_x < glyph_width; glyph_x++)
-          for (int glyph_y = 0; glyph_y < height; glyph_y++)
-            this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
+        this->filled_rectangle(x_at, y_start, glyph_width, height, color);
         x_at += glyph_width;
       }
 
@@ -182,15 +255,39 @@ void DisplayBuffer::print(int x, int y, Font *font, Color color, TextAlign align
     }
 
     const Glyph &glyph = font->get_glyphs()[glyph_n];
-    int scan_x1, scan_y1, scan_width, scan_height;
-    glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
-
-    for (int glyph_x = scan_x1; glyph_x < scan_x1 + scan_width; glyph_x++) {
-      for (int glyph_y = scan_y1; glyph_y < scan_y1 + scan_height; glyph_y++) {
-        if (glyph.get_pixel(glyph_x, glyph_y)) {
-          this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
+    const int glyph_x1 = x_at + glyph.offset_x_;
+    const int glyph_y1 = y_start + glyph.offset_y_;
+    if (glyph.is_anti_aliased()) {
+      if (this->can_blit_(glyph_x1, glyph_y1, glyph.width_, glyph.height_)) {
+        if (glyph.width_ > 0 && glyph.height_ > 0)
+          this->mark_dirty_(glyph_x1, glyph_y1, glyph_x1 + glyph.width_ - 1, glyph_y1 + glyph.height_ - 1);
+        glyph.for_each_alpha_pixel([this, x_at, y_start, color](int x, int y, uint8_t alpha) {
+          if (alpha == 255)
+            this->draw_absolute_pixel_internal(x_at + x, y_start + y, color);
+          else
+            this->blend_absolute_pixel_internal(x_at + x, y_start + y, color, alpha);
+        });
+      } else {
+        glyph.for_each_alpha_pixel([this, x_at, y_start, color](int x, int y, uint8_t alpha) {
+          this->blend_pixel_at(x_at + x, y_start + y, color, alpha);
+        });
+      }
+    } else if (this->can_blit_(glyph_x1, glyph_y1, glyph.width_, glyph.height_)) {
+      if (glyph.width_ > 0 && glyph.height_ > 0) {
+        this->mark_dirty_(glyph_x1, glyph_y1, glyph_x1 + glyph.width_ - 1, glyph_y1 + glyph.height_ - 1);
+        if (glyph.encoding_ == GLYPH_ENCODING_BITMAP) {
+          this->blit_bitmap_internal(glyph_x1, glyph_y1, glyph.data_, glyph.width_, glyph.height_, color);
+        } else {
+          glyph.for_each_span([this, x_at, y_start, color](int x, int y, int width) {
+            this->fill_rect_internal(x_at + x, y_start + y, width, 1, color);
+          });
         }
       }
+    } else {
+      // rotated or clipped, filled_rectangle() takes care of both
+      glyph.for_each_span([this, x_at, y_start, color](int x, int y, int width) {
+        this->filled_rectangle(x_at + x, y_start + y, width, 1, color);
+      });
     }
 
     x_at += glyph.width_ + glyph.offset_x_;
@@ -207,13 +304,20 @@ void DisplayBuffer::vprintf_(int x, int y, Font *font, Color color, TextAlign al
 
 void DisplayBuffer::image(int x, int y, Image *image, Color color_on, Color color_off) {
   switch (image->get_type()) {
-    case IMAGE_TYPE_BINARY:
+    case IMAGE_TYPE_BINARY: {
+      const uint8_t *bitmap = image->get_bitmap();
+      if (bitmap != nullptr && this->can_blit_(x, y, image->get_width(), image->get_height())) {
+        this->filled_rectangle(x, y, image->get_width(), image->get_height(), color_off);
+        this->blit_bitmap_internal(x, y, bitmap, image->get_width(), image->get_height(), color_on);
+        break;
+      }
       for (int img_x = 0; img_x < image->get_width(); img_x++) {
         for (int img_y = 0; img_y < image->get_height(); img_y++) {
           this->draw_pixel_at(x + img_x, y + img_y, image->get_pixel(img_x, img_y) ? color_on : color_off);
         }
       }
       break;
+    }
     case IMAGE_TYPE_GRAYSCALE:
       for (int img_x = 0; img_x < image->get_width(); img_x++) {
         for (int img_y = 0; img_y < image->get_height(); img_y++) {
@@ -228,6 +332,14 @@ void DisplayBuffer::image(int x, int y, Image *image, Color color_on, Color colo
         }
       }
       break;
+    case IMAGE_TYPE_RGBA:
+      for (int img_x = 0; img_x < image->get_width(); img_x++) {
+        for (int img_y = 0; img_y < image->get_height(); img_y++) {
+          this->blend_pixel_at(x + img_x, y + img_y, image->get_color_pixel(img_x, img_y),
+                               image->get_alpha_pixel(img_x, img_y));
+        }
+      }
+      break;
   }
 }
 
@@ -326,6 +438,128 @@ void DisplayBuffer::do_update_() {
     (*this->writer_)(*this);
   }
 }
+void HOT DisplayBuffer::mark_dirty_(int x1, int y1, int x2, int y2) {
+  x1 = std::max(x1, 0);
+  y1 = std::max(y1, 0);
+  x2 = std::min(x2, this->get_width_internal() - 1);
+  y2 = std::min(y2, this->get_height_internal() - 1);
+  if (x1 > x2 || y1 > y2)
+    return;
+  add_region_(this->dirty_regions_, DisplayRegion{int16_t(x1), int16_t(y1), int16_t(x2), int16_t(y2)});
+}
+void DisplayBuffer::mark_all_dirty_() {
+  this->mark_dirty_(0, 0, this->get_width_internal() - 1, this->get_height_internal() - 1);
+}
+void DisplayBuffer::set_buffer_layout_(DisplayBufferLayout layout, uint8_t bits_per_pixel) {
+  this->buffer_layout_ = layout;
+  this->bits_per_pixel_ = bits_per_pixel;
+  this->tile_hashes_valid_ = false;
+}
+void HOT DisplayBuffer::add_region_(std::vector<DisplayRegion> &regions, DisplayRegion region) {
+  for (auto &other : regions) {
+    if (other.contains(region))
+      return;
+  }
+  // Absorb all regions the new one touches, growing it can make it touch more of them
+  for (size_t i = 0; i < regions.size();) {
+    if (regions[i].touches(region)) {
+      region = region.merge(regions[i]);
+      regions[i] = regions.back();
+      regions.pop_back();
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+  if (regions.size() < MAX_DIRTY_REGIONS) {
+    regions.push_back(region);
+    return;
+  }
+
+  // Too many regions, merge with the one that adds the fewest unchanged pixels
+  size_t best = 0;
+  int best_waste = 0;
+  for (size_t i = 0; i < regions.size(); i++) {
+    int waste = regions[i].merge(region).area() - regions[i].area() - region.area();
+    if (i == 0 || waste < best_waste) {
+      best = i;
+      best_waste = waste;
+    }
+  }
+  region = region.merge(regions[best]);
+  regions[best] = regions.back();
+  regions.pop_back();
+  add_region_(regions, region);
+}
+uint32_t DisplayBuffer::hash_region_(const DisplayRegion &region) {
+  const uint32_t width = this->get_width_internal();
+  uint32_t hash = 2166136261UL;
+  if (this->buffer_layout_ == DISPLAY_BUFFER_LAYOUT_PAGES) {
+    for (int page = region.y1 / 8; page <= region.y2 / 8; page++) {
+      const uint8_t *row = this->buffer_ + page * width;
+      for (int x = region.x1; x <= region.x2; x++) {
+        hash ^= row[x];
+        hash *= 16777619UL;
+      }
+    }
+  } else {
+    const uint32_t bits = this->bits_per_pixel_;
+    for (uint32_t y = region.y1; y <= uint32_t(region.y2); y++) {
+      // Bytes shared with the neighbouring tiles are included in both
+      const uint32_t start = (y * width + region.x1) * bits / 8;
+      const uint32_t end = ((y * width + region.x2 + 1) * bits + 7) / 8;
+      for (uint32_t i = start; i < end; i++) {
+        hash ^= this->buffer_[i];
+        hash *= 16777619UL;
+      }
+    }
+  }
+  return hash;
+}
+const std::vector<DisplayRegion> &DisplayBuffer::get_flush_regions_() {
+  this->flush_regions_.clear();
+  if (!this->frame_diff_ || this->buffer_layout_ == DISPLAY_BUFFER_LAYOUT_UNKNOWN || this->buffer_ == nullptr) {
+    std::swap(this->flush_regions_, this->dirty_regions_);
+    return this->flush_regions_;
+  }
+
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  const int tiles_x = (width + FRAME_DIFF_TILE_SIZE - 1) / FRAME_DIFF_TILE_SIZE;
+  const int tiles_y = (height + FRAME_DIFF_TILE_SIZE - 1) / FRAME_DIFF_TILE_SIZE;
+  if (this->tile_hashes_ == nullptr) {
+    this->tile_hashes_ = new uint32_t[tiles_x * tiles_y];
+    this->tile_hashes_valid_ = false;
+  }
+  for (int ty = 0; ty < tiles_y; ty++) {
+    for (int tx = 0; tx < tiles_x; tx++) {
+      const int x1 = tx * FRAME_DIFF_TILE_SIZE;
+      const int y1 = ty * FRAME_DIFF_TILE_SIZE;
+      const DisplayRegion tile{int16_t(x1), int16_t(y1), int16_t(std::min(x1 + FRAME_DIFF_TILE_SIZE, width) - 1),
+                               int16_t(std::min(y1 + FRAME_DIFF_TILE_SIZE, height) - 1)};
+      bool dirty = false;
+      for (auto &region : this->dirty_regions_) {
+        if (region.intersects(tile)) {
+          dirty = true;
+          break;
+        }
+      }
+      // Without valid hashes, all tiles are hashed but only the dirty ones are sent
+      if (!dirty && this->tile_hashes_valid_)
+        continue;
+
+      const uint32_t hash = this->hash_region_(tile);
+      uint32_t &last_hash = this->tile_hashes_[ty * tiles_x + tx];
+      const bool changed = this->tile_hashes_valid_ ? hash != last_hash : dirty;
+      last_hash = hash;
+      if (changed)
+        add_region_(this->flush_regions_, tile);
+    }
+  }
+  this->tile_hashes_valid_ = true;
+  this->dirty_regions_.clear();
+  return this->flush_regions_;
+}
 #ifdef USE_TIME
 void DisplayBuffer::strftime(int x, int y, Font *font, Color color, TextAlign align, const char *format,
                              time::ESPTime time) {
@@ -346,18 +580,35 @@ void DisplayBuffer::strftime(int x, int y, Font *font, const char *format, time:
 #endif
 
 Glyph::Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-             int height)
+             int height, GlyphEncoding encoding)
     : char_(a_char),
       data_(data_start + offset),
       offset_x_(offset_x),
       offset_y_(offset_y),
       width_(width),
-      height_(height) {}
+      height_(height),
+      encoding_(encoding) {}
 bool Glyph::get_pixel(int x, int y) const {
   const int x_data = x - this->offset_x_;
   const int y_data = y - this->offset_y_;
   if (x_data < 0 || x_data >= this->width_ || y_data < 0 || y_data >= this->height_)
     return false;
+  if (this->encoding_ == GLYPH_ENCODING_SPANS) {
+    bool set = false;
+    this->for_each_span([x, y, &set](int span_x, int span_y, int span_width) {
+      if (span_y == y && x >= span_x && x < span_x + span_width)
+        set = true;
+    });
+    return set;
+  }
+  if (this->is_anti_aliased()) {
+    uint8_t pixel_alpha = 0;
+    this->for_each_alpha_pixel([x, y, &pixel_alpha](int pixel_x, int pixel_y, uint8_t alpha) {
+      if (pixel_x == x && pixel_y == y)
+        pixel_alpha = alpha;
+    });
+    return pixel_alpha >= 128;
+  }
   const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
   const uint32_t pos = x_data + y_data * width_8;
   return pgm_read_byte(this->data_ + (pos / 8u)) & (0x80 >> (pos % 8u));
@@ -366,14 +617,17 @@ const char *Glyph::get_char() const { return this->char_; }
 bool Glyph::compare_to(const char *str) const {
   // 1 -> this->char_
   // 2 -> str
+  // compare the bytes unsigned, the glyphs are sorted by their UTF-8 encoding
+  const auto *glyph_str = reinterpret_cast<const uint8_t *>(this->char_);
+  const auto *other_str = reinterpret_cast<const uint8_t *>(str);
   for (uint32_t i = 0;; i++) {
-    if (this->char_[i] == '\0')
+    if (glyph_str[i] == '\0')
       return true;
-    if (str[i] == '\0')
+    if (other_str[i] == '\0')
       return false;
-    if (this->char_[i] > str[i])
+    if (glyph_str[i] > other_str[i])
       return false;
-    if (this->char_[i] < str[i])
+    if (glyph_str[i] < other_str[i])
       return true;
   }
   // this should not happen
@@ -395,20 +649,84 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
   *width = this->width_;
   *height = this->height_;
 }
-int Font::match_next_glyph(const char *str, int *match_length) {
-  int lo = 0;
-  int hi = this->glyphs_.size() - 1;
-  while (lo != hi) {
-    int mid = (lo + hi + 1) / 2;
-    if (this->glyphs_[mid].compare_to(str))
-      lo = mid;
+/// Decode the UTF-8 sequence at the start of str, returns its length or 0 if it's not valid.
+static int decode_utf8(const char *str, uint32_t *codepoint) {
+  const auto *data = reinterpret_cast<const uint8_t *>(str);
+  int length;
+  if (data[0] < 0x80) {
+    *codepoint = data[0];
+    return 1;
+  } else if ((data[0] & 0xE0) == 0xC0) {
+    *codepoint = data[0] & 0x1F;
+    length = 2;
+  } else if ((data[0] & 0xF0) == 0xE0) {
+    *codepoint = data[0] & 0x0F;
+    length = 3;
+  } else if ((data[0] & 0xF8) == 0xF0) {
+    *codepoint = data[0] & 0x07;
+    length = 4;
+  } else {
+    return 0;
+  }
+  for (int i = 1; i < length; i++) {
+    // also stops at the end of the string
+    if ((data[i] & 0xC0) != 0x80)
+      return 0;
+    *codepoint = (*codepoint << 6) | (data[i] & 0x3F);
+  }
+  return length;
+}
+void Font::set_glyph_index(const uint8_t *ascii_index, const uint32_t *codepoints, size_t codepoint_count) {
+  this->ascii_index_ = ascii_index;
+  this->codepoints_ = codepoints;
+  this->codepoint_count_ = codepoint_count;
+}
+int Font::find_indexed_glyph_(const char *str) const {
+  const auto first = static_cast<uint8_t>(str[0]);
+  if (first < 0x80) {
+    const uint8_t index = pgm_read_byte(this->ascii_index_ + first);
+    return index == 0xFF ? -1 : index;
+  }
+
+  uint32_t codepoint;
+  if (decode_utf8(str, &codepoint) == 0)
+    return -1;
+  size_t lo = 0;
+  size_t hi = this->codepoint_count_;
+  while (lo < hi) {
+    const size_t mid = (lo + hi) / 2;
+    if (pgm_read_dword(this->codepoints_ + mid) < codepoint)
+      lo = mid + 1;
     else
-      hi = mid - 1;
+      hi = mid;
   }
-  *match_length = this->glyphs_[lo].match_length(str);
+  if (lo == this->codepoint_count_ || pgm_read_dword(this->codepoints_ + lo) != codepoint)
+    return -1;
+  return this->glyphs_.size() - this->codepoint_count_ + lo;
+}
+int Font::match_next_glyph(const char *str, int *match_length) {
+  int index;
+  if (this->ascii_index_ != nullptr) {
+    index = this->find_indexed_glyph_(str);
+    if (index < 0)
+      return -1;
+  } else {
+    int lo = 0;
+    int hi = this->glyphs_.size() - 1;
+    while (lo != hi) {
+      int mid = (lo + hi + 1) / 2;
+      if (this->glyphs_[mid].compare_to(str))
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+    index = lo;
+  }
+  // confirms the match, so malformed UTF-8 is handled like before
+  *match_length = this->glyphs_[index].match_length(str);
   if (*match_length <= 0)
     return -1;
-  return lo;
+  return index;
 }
 void Font::measure(const char *str, int *width, int *x_offset, int *baseline, int *height) {
   *baseline = this->baseline_;
@@ -455,12 +773,19 @@ bool Image::get_pixel(int x, int y) const {
 Color Image::get_color_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return 0;
-  const uint32_t pos = (x + y * this->width_) * 3;
+  const uint32_t pos = (x + y * this->width_) * (this->type_ == IMAGE_TYPE_RGBA ? 4 : 3);
   const uint32_t color32 = (pgm_read_byte(this->data_start_ + pos + 2) << 0) |
                            (pgm_read_byte(this->data_start_ + pos + 1) << 8) |
                            (pgm_read_byte(this->data_start_ + pos + 0) << 16);
   return Color(color32);
 }
+uint8_t Image::get_alpha_pixel(int x, int y) const {
+  if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
+    return 0;
+  if (this->type_ != IMAGE_TYPE_RGBA)
+    return 255;
+  return pgm_read_byte(this->data_start_ + (x + y * this->width_) * 4 + 3);
+}
 Color Image::get_grayscale_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return 0;
@@ -468,6 +793,7 @@ Color Image::get_grayscale_pixel(int x, int y) const {
   const uint8_t gray = pgm_read_byte(this->data_start_ + pos);
   return Color(gray | gray << 8 | gray << 16 | gray << 24);
 }
+const uint8_t *Image::get_bitmap() const { return this->data_start_; }
 int Image::get_width() const { return this->width_; }
 int Image::get_height() const { return this->height_; }
 ImageType Image::get_type() const { return this->type_; }
@@ -506,6 +832,13 @@ Color Animation::get_grayscale_pixel(int x, int y) const {
   const uint8_t gray = pgm_read_byte(this->data_start_ + pos);
   return Color(gray | gray << 8 | gray << 16 | gray << 24);
 }
+const uint8_t *Animation::get_bitmap() const {
+  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
+  const uint32_t frame_index = this->height_ * width_8 * this->current_frame_;
+  if (frame_index >= this->width_ * this->height_ * this->animation_frame_count_)
+    return nullptr;
+  return this->data_start_ + frame_index / 8u;
+}
 Animation::Animation(const uint8_t *data_start, int width, int height, uint32_t animation_frame_count, ImageType type)
     : Image(data_start, width, height, type), animation_frame_count_(animation_frame_count) {
   current_frame_ = 0;
@@ -68,7 +68,24 @@ extern const Color COLOR_OFF;
 /// Turn the pixel ON.
 extern const Color COLOR_ON;
 
-enum ImageType { IMAGE_TYPE_BINARY = 0, IMAGE_TYPE_GRAYSCALE = 1, IMAGE_TYPE_RGB24 = 2 };
+enum ImageType { IMAGE_TYPE_BINARY = 0, IMAGE_TYPE_GRAYSCALE = 1, IMAGE_TYPE_RGB24 = 2, IMAGE_TYPE_RGBA = 3 };
+
+/// How the pixels of a glyph are stored.
+enum GlyphEncoding : uint8_t {
+  /// 1 bit per pixel in the format of for_each_bitmap_pixel().
+  GLYPH_ENCODING_BITMAP = 0,
+  /** Horizontal spans of set pixels, which is smaller for large fonts and drawn without looking at single pixels.
+   *
+   * Every row is a sequence of bytes that each skip (high nibble) and then draw (low nibble) a number of pixels,
+   * terminated by a zero byte. Longer gaps and spans are split over several bytes.
+   */
+  GLYPH_ENCODING_SPANS = 1,
+  /// Anti-aliased, an alpha value of 2, 4 or 8 bits per pixel, most significant bits first and every row padded to
+  /// a whole byte.
+  GLYPH_ENCODING_ALPHA_2BPP = 2,
+  GLYPH_ENCODING_ALPHA_4BPP = 3,
+  GLYPH_ENCODING_ALPHA_8BPP = 4,
+};
 
 enum DisplayRotation {
   DISPLAY_ROTATION_0_DEGREES = 0,
@@ -77,6 +94,91 @@ enum DisplayRotation {
   DISPLAY_ROTATION_270_DEGREES = 270,
 };
 
+/// How a driver stores its pixels in the buffer, which is needed to compare frames.
+enum DisplayBufferLayout {
+  /// Unknown layout, frames can't be compared.
+  DISPLAY_BUFFER_LAYOUT_UNKNOWN = 0,
+  /// One row after the other, with bits_per_pixel bits per pixel (several pixels per byte if less than 8).
+  DISPLAY_BUFFER_LAYOUT_ROWS,
+  /// Pages of 8 rows, with one byte per column and page.
+  DISPLAY_BUFFER_LAYOUT_PAGES,
+};
+
+/// A rectangle of the display in absolute (unrotated) coordinates, x2 and y2 are inclusive.
+struct DisplayRegion {
+  int16_t x1;
+  int16_t y1;
+  int16_t x2;
+  int16_t y2;
+
+  int width() const { return this->x2 - this->x1 + 1; }
+  int height() const { return this->y2 - this->y1 + 1; }
+  int area() const { return this->width() * this->height(); }
+  bool contains(const DisplayRegion &other) const {
+    return this->x1 <= other.x1 && other.x2 <= this->x2 && this->y1 <= other.y1 && other.y2 <= this->y2;
+  }
+  bool intersects(const DisplayRegion &other) const {
+    return this->x1 <= other.x2 && other.x1 <= this->x2 && this->y1 <= other.y2 && other.y1 <= this->y2;
+  }
+  /// Whether the regions intersect or are directly next to each other.
+  bool touches(const DisplayRegion &other) const {
+    return this->x1 <= other.x2 + 1 && other.x1 <= this->x2 + 1 && this->y1 <= other.y2 + 1 &&
+           other.y1 <= this->y2 + 1;
+  }
+  /// The smallest region containing both regions.
+  DisplayRegion merge(const DisplayRegion &other) const {
+    return DisplayRegion{std::min(this->x1, other.x1), std::min(this->y1, other.y1), std::max(this->x2, other.x2),
+                         std::max(this->y2, other.y2)};
+  }
+};
+
+/** Call func(x, y) for every set bit of a bitmap stored in flash.
+ *
+ * The bitmap has 1 bit per pixel, most significant bit first, with every row padded to a whole byte, which is the
+ * format of glyphs and binary images.
+ */
+template<typename F> void for_each_bitmap_pixel(const uint8_t *data, int width, int height, F &&func) {
+  const int stride = (width + 7) / 8;
+  for (int y = 0; y < height; y++) {
+    const uint8_t *row = data + y * stride;
+    for (int x = 0; x < width; x += 8) {
+      uint8_t bits = pgm_read_byte(row + x / 8);
+      if (width - x < 8)
+        bits &= 0xFF << (8 - (width - x));
+      for (int bit_x = x; bits != 0; bit_x++, bits <<= 1) {
+        if (bits & 0x80)
+          func(bit_x, y);
+      }
+    }
+  }
+}
+
+/** Blend an RGB565 color over another one, with alpha from 0 (keep the background) to 255 (replace it).
+ *
+ * Red and blue are spread over a 32-bit word with enough room between them that both are blended with one
+ * multiplication, green gets its own so that its 6 bits keep the full 8-bit alpha. Rounded to the nearest value.
+ */
+inline uint16_t blend_rgb565(uint16_t foreground, uint16_t background, uint8_t alpha) {
+  // 0..255 -> 0..256, so that 255 replaces the background
+  const uint32_t a = alpha + (alpha >> 7u);
+  const uint32_t fg_rb = (foreground & 0x001FUL) | (uint32_t(foreground & 0xF800UL) << 5u);
+  const uint32_t bg_rb = (background & 0x001FUL) | (uint32_t(background & 0xF800UL) << 5u);
+  const uint32_t rb = ((fg_rb * a + bg_rb * (256u - a) + 0x00800080UL) >> 8u) & 0x001F001FUL;
+  const uint32_t fg_g = (foreground >> 5u) & 0x3Fu;
+  const uint32_t bg_g = (background >> 5u) & 0x3Fu;
+  const uint32_t g = (fg_g * a + bg_g * (256u - a) + 0x80u) >> 8u;
+  return (rb & 0x001Fu) | ((rb >> 5u) & 0xF800u) | (g << 5u);
+}
+/// Blend an RGB332 color over another one like blend_rgb565(), all three channels fit in one multiplication.
+inline uint8_t blend_rgb332(uint8_t foreground, uint8_t background, uint8_t alpha) {
+  const uint32_t a = alpha + (alpha >> 7u);
+  const uint32_t fg = (foreground & 0xE0UL) << 16u | (foreground & 0x1CUL) << 8u | (foreground & 0x03UL);
+  const uint32_t bg = (background & 0xE0UL) << 16u | (background & 0x1CUL) << 8u | (background & 0x03UL);
+  // rounding offsets for the red (bit 21), green (bit 10) and blue (bit 0) fields
+  const uint32_t result = ((fg * a + bg * (256u - a) + 0x10020080UL) >> 8u) & 0x00E01C03UL;
+  return (result >> 16u) | (result >> 8u) | result;
+}
+
 class Font;
 class Image;
 class DisplayBuffer;
@@ -104,6 +206,8 @@ class DisplayBuffer {
   int get_height();
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color = COLOR_ON);
+  /// Blend a color over the pixel at the specified coordinates, alpha from 0 (transparent) to 255 (opaque).
+  void blend_pixel_at(int x, int y, Color color, uint8_t alpha);
 
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
@@ -269,6 +373,8 @@ class DisplayBuffer {
    * @param image The image to draw
    * @param color_on The color to replace in binary images for the on bits.
    * @param color_off The color to replace in binary images for the off bits.
+   *
+   * RGBA images are blended over the content of the display.
    */
   void image(int x, int y, Image *image, Color color_on = COLOR_ON, Color color_off = COLOR_OFF);
 
@@ -299,23 +405,83 @@ class DisplayBuffer {
   /// Internal method to set the display rotation with.
   void set_rotation(DisplayRotation rotation);
 
+  /** Compare each frame with the previous one and only transmit the parts that changed.
+   *
+   * Every update redraws the whole screen, so without this all of it counts as changed. With it, a hash of each
+   * 16x16 pixel tile is kept and tiles whose content is the same as in the previous frame are skipped. Only has an
+   * effect with drivers that set their buffer layout.
+   */
+  void set_frame_diff(bool frame_diff) { this->frame_diff_ = frame_diff; }
+
  protected:
   void vprintf_(int x, int y, Font *font, Color color, TextAlign align, const char *format, va_list arg);
 
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /** Blend color over the pixel at absolute coordinates, alpha from 0 (keep the pixel) to 255 (replace it).
+   *
+   * Drivers that can read back the colors of their buffer override this, by default the pixel is replaced if alpha is
+   * at least 128.
+   */
+  virtual void blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha);
+
+  /** Fill a rectangle in absolute coordinates, which is completely on the display.
+   *
+   * Drivers can override this to write whole rows to their buffer at once, by default every pixel is drawn with
+   * draw_absolute_pixel_internal().
+   */
+  virtual void fill_rect_internal(int x1, int y1, int width, int height, Color color);
+
+  /** Draw the set pixels of a bitmap (see for_each_bitmap_pixel()) in absolute coordinates with the given color.
+   *
+   * The bitmap is completely on the display, the pixels of unset bits keep their color. Drivers can override this
+   * to avoid the virtual call and bounds checks of draw_absolute_pixel_internal() per pixel.
+   */
+  virtual void blit_bitmap_internal(int x1, int y1, const uint8_t *data, int width, int height, Color color);
+
+  /// Whether a bitmap at [x,y] can be drawn with blit_bitmap_internal(), which needs it fully on the display.
+  bool can_blit_(int x, int y, int width, int height);
+
   virtual int get_height_internal() = 0;
 
   virtual int get_width_internal() = 0;
 
   void init_internal_(uint32_t buffer_length);
 
+  /// Apply the rotation to coordinates like draw_pixel_at() does.
+  void rotate_point_(int *x, int *y);
+
   void do_update_();
 
+  /// Mark a region (in absolute coordinates) as changed, to be returned by the next get_flush_regions_().
+  void mark_dirty_(int x1, int y1, int x2, int y2);
+  /// Mark the whole display as changed, for drivers that write to the buffer directly like in fill().
+  void mark_all_dirty_();
+  /// Tell the frame diff how the buffer is laid out, frame diff is only available if this is set.
+  void set_buffer_layout_(DisplayBufferLayout layout, uint8_t bits_per_pixel);
+  /** The regions that have to be transmitted to the display, and reset them.
+   *
+   * Those are the regions marked as changed since the last call, narrowed down to the tiles whose content differs
+   * from the last call if frame diff is enabled. The regions don't overlap and there are at most a few of them, as
+   * regions that touch or would be too many are merged. The result is valid until the next call.
+   */
+  const std::vector<DisplayRegion> &get_flush_regions_();
+  /// Add a region to a list of regions, merging it with the regions it touches.
+  static void add_region_(std::vector<DisplayRegion> &regions, DisplayRegion region);
+  uint32_t hash_region_(const DisplayRegion &region);
+
   uint8_t *buffer_{nullptr};
   DisplayRotation rotation_{DISPLAY_ROTATION_0_DEGREES};
   optional<display_writer_t> writer_{};
   DisplayPage *page_{nullptr};
+  std::vector<DisplayRegion> dirty_regions_;
+  std::vector<DisplayRegion> flush_regions_;
+  bool frame_diff_{false};
+  DisplayBufferLayout buffer_layout_{DISPLAY_BUFFER_LAYOUT_UNKNOWN};
+  uint8_t bits_per_pixel_{0};
+  /// The hash of every tile when the frame was last flushed.
+  uint32_t *tile_hashes_{nullptr};
+  bool tile_hashes_valid_{false};
 };
 
 class DisplayPage {
@@ -339,10 +505,18 @@ class DisplayPage {
 class Glyph {
  public:
   Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-        int height);
+        int height, GlyphEncoding encoding = GLYPH_ENCODING_BITMAP);
 
   bool get_pixel(int x, int y) const;
 
+  /// Call func(x, y, width) for every horizontal span of set pixels, in the coordinates of get_pixel(). Not for
+  /// anti-aliased glyphs.
+  template<typename F> void for_each_span(F &&func) const;
+  /// Call func(x, y, alpha) for every pixel of an anti-aliased glyph that isn't transparent, alpha from 1 to 255.
+  template<typename F> void for_each_alpha_pixel(F &&func) const;
+
+  bool is_anti_aliased() const { return this->encoding_ >= GLYPH_ENCODING_ALPHA_2BPP; }
+
   const char *get_char() const;
 
   bool compare_to(const char *str) const;
@@ -361,8 +535,74 @@ class Glyph {
   int offset_y_;
   int width_;
   int height_;
+  GlyphEncoding encoding_;
 };
 
+template<typename F> void Glyph::for_each_span(F &&func) const {
+  if (this->encoding_ == GLYPH_ENCODING_SPANS) {
+    const uint8_t *data = this->data_;
+    for (int y = 0; y < this->height_; y++) {
+      int x = 0, span_x = 0, span_width = 0;
+      uint8_t code;
+      while ((code = pgm_read_byte(data++)) != 0) {
+        const int skip = code >> 4;
+        if (skip != 0 && span_width != 0) {
+          func(this->offset_x_ + span_x, this->offset_y_ + y, span_width);
+          span_width = 0;
+        }
+        x += skip;
+        // a span without a gap before it continues the previous one
+        if (span_width == 0)
+          span_x = x;
+        span_width += code & 0x0F;
+        x += code & 0x0F;
+      }
+      if (span_width != 0)
+        func(this->offset_x_ + span_x, this->offset_y_ + y, span_width);
+    }
+    return;
+  }
+
+  const int stride = (this->width_ + 7) / 8;
+  for (int y = 0; y < this->height_; y++) {
+    const uint8_t *row = this->data_ + y * stride;
+    int span_x = 0, span_width = 0;
+    uint8_t bits = 0;
+    for (int x = 0; x < this->width_; x++, bits <<= 1) {
+      if (x % 8 == 0)
+        bits = pgm_read_byte(row + x / 8);
+      if (bits & 0x80) {
+        if (span_width == 0)
+          span_x = x;
+        span_width++;
+      } else if (span_width != 0) {
+        func(this->offset_x_ + span_x, this->offset_y_ + y, span_width);
+        span_width = 0;
+      }
+    }
+    if (span_width != 0)
+      func(this->offset_x_ + span_x, this->offset_y_ + y, span_width);
+  }
+}
+
+template<typename F> void Glyph::for_each_alpha_pixel(F &&func) const {
+  const int bpp = this->encoding_ == GLYPH_ENCODING_ALPHA_2BPP   ? 2
+                  : this->encoding_ == GLYPH_ENCODING_ALPHA_4BPP ? 4
+                                                                 : 8;
+  const int max = (1 << bpp) - 1;
+  const int scale = 255 / max;
+  const int stride = (this->width_ * bpp + 7) / 8;
+  for (int y = 0; y < this->height_; y++) {
+    const uint8_t *row = this->data_ + y * stride;
+    for (int x = 0; x < this->width_; x++) {
+      const int bit = x * bpp;
+      const int value = (pgm_read_byte(row + bit / 8) >> (8 - bpp - bit % 8)) & max;
+      if (value != 0)
+        func(this->offset_x_ + x, this->offset_y_ + y, uint8_t(value * scale));
+    }
+  }
+}
+
 class Font {
  public:
   /** Construct the font with the given glyphs.
@@ -373,6 +613,15 @@ class Font {
    */
   Font(std::vector<Glyph> &&glyphs, int baseline, int bottom);
 
+  /** Look up glyphs by their codepoint instead of searching the glyph strings, for fonts whose glyphs are all single
+   * characters.
+   *
+   * @param ascii_index The glyph index of each of the 128 ASCII characters, 0xFF if there is none.
+   * @param codepoints The sorted codepoints of the non-ASCII glyphs, which are the last codepoint_count glyphs.
+   * @param codepoint_count The number of non-ASCII glyphs.
+   */
+  void set_glyph_index(const uint8_t *ascii_index, const uint32_t *codepoints, size_t codepoint_count);
+
   int match_next_glyph(const char *str, int *match_length);
 
   void measure(const char *str, int *width, int *x_offset, int *baseline, int *height);
@@ -380,9 +629,14 @@ class Font {
   const std::vector<Glyph> &get_glyphs() const;
 
  protected:
+  int find_indexed_glyph_(const char *str) const;
+
   std::vector<Glyph> glyphs_;
   int baseline_;
   int bottom_;
+  const uint8_t *ascii_index_{nullptr};
+  const uint32_t *codepoints_{nullptr};
+  size_t codepoint_count_{0};
 };
 
 class Image {
@@ -391,6 +645,10 @@ class Image {
   virtual bool get_pixel(int x, int y) const;
   virtual Color get_color_pixel(int x, int y) const;
   virtual Color get_grayscale_pixel(int x, int y) const;
+  /// The alpha value of a pixel of an RGBA image, from 0 (transparent) to 255 (opaque).
+  virtual uint8_t get_alpha_pixel(int x, int y) const;
+  /// The data of a binary image in the format of for_each_bitmap_pixel().
+  virtual const uint8_t *get_bitmap() const;
   int get_width() const;
   int get_height() const;
   ImageType get_type() const;
@@ -408,6 +666,7 @@ class Animation : public Image {
   bool get_pixel(int x, int y) const override;
   Color get_color_pixel(int x, int y) const override;
   Color get_grayscale_pixel(int x, int y) const override;
+  const uint8_t *get_bitmap() const override;
 
   int get_animation_frame_count() const;
   int get_current_frame() const;
@@ -2,6 +2,8 @@
 #include "e131_addressable_light_effect.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 #ifdef ARDUINO_ARCH_ESP32
 #include <WiFi.h>
 #endif
@@ -38,19 +40,18 @@ void E131Component::setup() {
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
   E131Packet packet;
   int universe = 0;
 
   while (uint16_t packet_size = udp_->parsePacket()) {
-    payload.resize(packet_size);
-
-    if (!udp_->read(&payload[0], payload.size())) {
+    // longer packets are invalid anyway, read what fits and let packet_() reject them
+    const int read = udp_->read(receive_buffer_, std::min<size_t>(packet_size, sizeof(receive_buffer_)));
+    if (read <= 0) {
       continue;
     }
 
-    if (!packet_(payload, universe, packet)) {
-      ESP_LOGV(TAG, "Invalid packet recevied of size %zu.", payload.size());
+    if (!packet_(receive_buffer_, read, universe, packet)) {
+      ESP_LOGV(TAG, "Invalid packet recevied of size %u.", packet_size);
       continue;
     }
 
@@ -16,10 +16,21 @@ class E131AddressableLightEffect;
 enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
+const int E131_MAX_PACKET_SIZE = 638;
 
+/// A parsed E1.31 packet, the values point into the receive buffer of E131Component.
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  uint8_t sequence_number;
+  const uint8_t *values;  ///< values[0] is the DMX start code, followed by count - 1 slots
+};
+
+/// Counters for the frames an E1.31 effect received.
+struct E131Statistics {
+  uint32_t frames{0};        ///< Frames shown after all universes arrived.
+  uint32_t late_frames{0};   ///< Frames shown before all universes arrived, because the next frame already started.
+  uint32_t out_of_order{0};  ///< Packets ignored because their sequence number was older than the last one.
+  uint32_t dropped{0};       ///< Packets missing from the sequence numbers.
 };
 
 class E131Component : public esphome::Component {
@@ -39,7 +50,7 @@ class E131Component : public esphome::Component {
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  bool packet_(const uint8_t *data, size_t size, int &universe, E131Packet &packet);
   bool process_(int universe, const E131Packet &packet);
   bool join_igmp_groups_();
   void join_(int universe);
@@ -50,7 +61,8 @@ class E131Component : public esphome::Component {
   std::unique_ptr<UDP> udp_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  /// Packets are parsed in place and handed to the effects without copying.
+  uint8_t receive_buffer_[E131_MAX_PACKET_SIZE];
 };
 
 }  // namespace e131
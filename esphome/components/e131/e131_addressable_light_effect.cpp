@@ -6,7 +6,9 @@ namespace esphome {
 namespace e131 {
 
 static const char *TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = (E131_MAX_PROPERTY_VALUES_COUNT - 1);
+// E1.31 receivers ignore packets whose sequence number is up to this much older than the last one
+static const int8_t SEQUENCE_NUMBER_WINDOW = -20;
 
 E131AddressableLightEffect::E131AddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
 
@@ -27,6 +29,10 @@ int E131AddressableLightEffect::get_universe_count() const {
 void E131AddressableLightEffect::start() {
   AddressableLightEffect::start();
 
+  this->universes_.assign(this->get_universe_count(), UniverseState{0, false, false});
+  this->universes_received_ = 0;
+  this->statistics_ = E131Statistics{};
+
   if (this->e131_) {
     this->e131_->add_effect(this);
   }
@@ -37,6 +43,10 @@ void E131AddressableLightEffect::stop() {
     this->e131_->remove_effect(this);
   }
 
+  ESP_LOGD(TAG, "'%s' showed %u frames, %u late. %u packets out of order, %u dropped.", get_name().c_str(),
+           this->statistics_.frames, this->statistics_.late_frames, this->statistics_.out_of_order,
+           this->statistics_.dropped);
+
   AddressableLightEffect::stop();
 }
 
@@ -51,40 +61,82 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
   if (universe < first_universe_ || universe > get_last_universe())
     return false;
 
+  const size_t index = universe - first_universe_;
+  if (index >= this->universes_.size())
+    return false;
+
+  auto &state = this->universes_[index];
+  if (state.seen) {
+    const int8_t diff = packet.sequence_number - state.sequence_number;
+    if (diff <= 0 && diff > SEQUENCE_NUMBER_WINDOW) {
+      this->statistics_.out_of_order++;
+      return true;
+    }
+    if (diff > 1)
+      this->statistics_.dropped += diff - 1;
+    // the next frame started before the current one was complete, show what we have
+    if (state.received)
+      this->show_frame_(false);
+  }
+  state.seen = true;
+  state.sequence_number = packet.sequence_number;
+
   int output_offset = (universe - first_universe_) * get_lights_per_universe();
   // limit amount of lights per universe and received
-  int output_end = std::min(it->size(), std::min(output_offset + get_lights_per_universe(), packet.count - 1));
+  int output_end =
+      std::min(it->size(), output_offset + std::min(get_lights_per_universe(), (packet.count - 1) / channels_));
   auto input_data = packet.values + 1;
 
   ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %d-%d.", get_name().c_str(), universe, output_offset,
            output_end);
 
+  const int count = output_end - output_offset;
+
   switch (channels_) {
     case E131_MONO:
-      for (; output_offset < output_end; output_offset++, input_data++) {
-        auto output = (*it)[output_offset];
-        output.set(light::ESPColor(input_data[0], input_data[0], input_data[0], input_data[0]));
-      }
+      it->write_generated(output_offset, count, [&input_data](int32_t) {
+        const uint8_t value = *input_data++;
+        return light::ESPColor(value, value, value, value);
+      });
       break;
 
     case E131_RGB:
-      for (; output_offset < output_end; output_offset++, input_data += 3) {
-        auto output = (*it)[output_offset];
-        output.set(light::ESPColor(input_data[0], input_data[1], input_data[2],
-                                   (input_data[0] + input_data[1] + input_data[2]) / 3));
-      }
+      it->write_generated(output_offset, count, [&input_data](int32_t) {
+        const uint8_t *rgb = input_data;
+        input_data += 3;
+        return light::ESPColor(rgb[0], rgb[1], rgb[2], (rgb[0] + rgb[1] + rgb[2]) / 3);
+      });
       break;
 
     case E131_RGBW:
-      for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(light::ESPColor(input_data[0], input_data[1], input_data[2], input_data[3]));
-      }
+      it->write_generated(output_offset, count, [&input_data](int32_t) {
+        const uint8_t *rgbw = input_data;
+        input_data += 4;
+        return light::ESPColor(rgbw[0], rgbw[1], rgbw[2], rgbw[3]);
+      });
       break;
   }
 
+  state.received = true;
+  if (++this->universes_received_ == this->universes_.size())
+    this->show_frame_(true);
+
   return true;
 }
 
+void E131AddressableLightEffect::show_frame_(bool complete) {
+  if (complete) {
+    this->statistics_.frames++;
+  } else {
+    this->statistics_.late_frames++;
+  }
+
+  this->get_addressable_()->schedule_show();
+
+  for (auto &state : this->universes_)
+    state.received = false;
+  this->universes_received_ = 0;
+}
+
 }  // namespace e131
 }  // namespace esphome
@@ -2,13 +2,13 @@
 
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
+#include "e131.h"
+
+#include <vector>
 
 namespace esphome {
 namespace e131 {
 
-class E131Component;
-struct E131Packet;
-
 enum E131LightChannels { E131_MONO = 1, E131_RGB = 3, E131_RGBW = 4 };
 
 class E131AddressableLightEffect : public light::AddressableLightEffect {
@@ -26,6 +26,7 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
   int get_first_universe() const;
   int get_last_universe() const;
   int get_universe_count() const;
+  const E131Statistics &get_statistics() const { return this->statistics_; }
 
  public:
   void set_first_universe(int universe) { this->first_universe_ = universe; }
@@ -34,12 +35,25 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
 
  protected:
   bool process_(int universe, const E131Packet &packet);
+  void show_frame_(bool complete);
+  // only show once all universes of a frame arrived
+  bool schedules_show_() const override { return true; }
 
  protected:
+  /// Frame assembly state of one of the universes of this effect.
+  struct UniverseState {
+    uint8_t sequence_number;
+    bool seen;      ///< A packet was received for this universe since the effect started.
+    bool received;  ///< The packet of this universe for the current frame was received.
+  };
+
   int first_universe_{0};
   int last_universe_{0};
   E131LightChannels channels_{E131_RGB};
   E131Component *e131_{nullptr};
+  std::vector<UniverseState> universes_;
+  size_t universes_received_{0};
+  E131Statistics statistics_{};
 
   friend class E131Component;
 };
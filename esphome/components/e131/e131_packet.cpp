@@ -46,7 +46,7 @@ union E131RawPacket {
     uint8_t property_values[E131_MAX_PROPERTY_VALUES_COUNT];
   } __attribute__((packed));
 
-  uint8_t raw[638];
+  uint8_t raw[E131_MAX_PACKET_SIZE];
 };
 
 // We need to have at least one `1` value
@@ -106,11 +106,11 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t size, int &universe, E131Packet &packet) {
+  if (size < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -125,10 +125,14 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
 
   universe = htons(sbuff->universe);
   packet.count = htons(sbuff->property_value_count);
-  if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
+  if (packet.count < 1 || packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
+    return false;
+  // all values have to be in the received data
+  if (size < static_cast<size_t>(E131_MIN_PACKET_SIZE - 1 + packet.count))
     return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  packet.sequence_number = sbuff->sequence_number;
+  packet.values = sbuff->property_values;
   return true;
 }
 
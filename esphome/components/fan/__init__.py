@@ -69,6 +69,7 @@ def register_fan(var, config):
     cg.add(cg.App.register_fan(var))
     yield cg.register_component(var, config)
     yield setup_fan_core_(var, config)
+    cg.add_object_id_hash(var, config[CONF_NAME])
 
 
 @coroutine
@@ -19,6 +19,8 @@ void FastLEDLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "FastLED light:");
   ESP_LOGCONFIG(TAG, "  Num LEDs: %u", this->num_leds_);
   ESP_LOGCONFIG(TAG, "  Max refresh rate: %u", *this->max_refresh_rate_);
+  if (this->frame_interval_us_ != 0)
+    ESP_LOGCONFIG(TAG, "  Frame rate: %.1f fps", 1000000.0f / this->frame_interval_us_);
 }
 void FastLEDLightOutput::loop() {
   if (!this->should_show_())
@@ -34,6 +36,7 @@ void FastLEDLightOutput::loop() {
 
   ESP_LOGVV(TAG, "Writing RGB values to bus...");
   this->controller_->showLeds();
+  this->record_show_time_(micros() - now);
 }
 
 }  // namespace fastled_base
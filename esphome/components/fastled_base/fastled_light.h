@@ -227,6 +227,21 @@ class FastLEDLightOutput : public light::AddressableLight {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
   }
+  void write_range_internal(int32_t start, const light::ESPColor *colors, int32_t count, bool write_white) override {
+    static const uint8_t OFFSETS[3] = {0, 1, 2};
+    this->correction_.color_correct_range(colors, count, this->leds_[start].raw, sizeof(CRGB), OFFSETS, 3);
+  }
+  void fill_internal(int32_t start, int32_t count, const light::ESPColor &color) override {
+    const CRGB corrected(this->correction_.color_correct_red(color.r), this->correction_.color_correct_green(color.g),
+                         this->correction_.color_correct_blue(color.b));
+    std::fill(this->leds_ + start, this->leds_ + start + count, corrected);
+  }
+  void move_internal(int32_t dst, int32_t src, int32_t count) override {
+    memmove(this->leds_ + dst, this->leds_ + src, count * sizeof(CRGB));
+  }
+  void rotate_internal(int32_t amnt) override {
+    std::rotate(this->leds_, this->leds_ + amnt, this->leds_ + this->num_leds_);
+  }
 
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
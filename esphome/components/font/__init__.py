@@ -12,6 +12,16 @@ MULTI_CONF = True
 
 Font = display.display_ns.class_('Font')
 Glyph = display.display_ns.class_('Glyph')
+GlyphEncoding = display.display_ns.enum('GlyphEncoding')
+GLYPH_ENCODING = {
+    'BITMAP': GlyphEncoding.GLYPH_ENCODING_BITMAP,
+    'SPANS': GlyphEncoding.GLYPH_ENCODING_SPANS,
+}
+GLYPH_ENCODING_ALPHA = {
+    2: GlyphEncoding.GLYPH_ENCODING_ALPHA_2BPP,
+    4: GlyphEncoding.GLYPH_ENCODING_ALPHA_4BPP,
+    8: GlyphEncoding.GLYPH_ENCODING_ALPHA_8BPP,
+}
 
 
 def validate_glyphs(value):
@@ -65,16 +75,89 @@ def validate_truetype_file(value):
 
 DEFAULT_GLYPHS = ' !"%()+,-.:0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz°'
 CONF_RAW_DATA_ID = 'raw_data_id'
+CONF_ASCII_INDEX_ID = 'ascii_index_id'
+CONF_CODEPOINTS_ID = 'codepoints_id'
+CONF_ENCODING = 'encoding'
+CONF_BPP = 'bpp'
+
+
+def validate_encoding(config):
+    if config[CONF_BPP] != 1 and config[CONF_ENCODING] == 'SPANS':
+        raise cv.Invalid("The SPANS encoding is only available for fonts with 1 bit per pixel")
+    return config
+
 
 FONT_SCHEMA = cv.Schema({
     cv.Required(CONF_ID): cv.declare_id(Font),
     cv.Required(CONF_FILE): validate_truetype_file,
     cv.Optional(CONF_GLYPHS, default=DEFAULT_GLYPHS): validate_glyphs,
     cv.Optional(CONF_SIZE, default=20): cv.int_range(min=1),
+    cv.Optional(CONF_ENCODING, default='BITMAP'): cv.enum(GLYPH_ENCODING, upper=True),
+    cv.Optional(CONF_BPP, default=1): cv.one_of(1, 2, 4, 8, int=True),
     cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
+    cv.GenerateID(CONF_ASCII_INDEX_ID): cv.declare_id(cg.uint8),
+    cv.GenerateID(CONF_CODEPOINTS_ID): cv.declare_id(cg.uint32),
 })
 
-CONFIG_SCHEMA = cv.All(validate_pillow_installed, FONT_SCHEMA)
+CONFIG_SCHEMA = cv.All(validate_pillow_installed, FONT_SCHEMA, validate_encoding)
+
+
+def encode_bitmap(mask, width, height):
+    """Encode a glyph with 1 bit per pixel, every row padded to a whole byte."""
+    width8 = ((width + 7) // 8) * 8
+    data = [0 for _ in range(height * width8 // 8)]  # noqa: F812
+    for y in range(height):
+        for x in range(width):
+            if not mask.getpixel((x, y)):
+                continue
+            pos = x + y * width8
+            data[pos // 8] |= 0x80 >> (pos % 8)
+    return data
+
+
+def encode_spans(mask, width, height):
+    """Encode a glyph as horizontal spans, each byte skips (high nibble) and then draws (low nibble)
+    a number of pixels and every row ends with a zero byte."""
+    data = []
+    for y in range(height):
+        pos = 0
+        x = 0
+        while x < width:
+            if not mask.getpixel((x, y)):
+                x += 1
+                continue
+            start = x
+            while x < width and mask.getpixel((x, y)):
+                x += 1
+            skip = start - pos
+            while skip > 15:
+                data.append(0xF0)
+                skip -= 15
+            length = x - start
+            data.append((skip << 4) | min(length, 15))
+            length -= min(length, 15)
+            while length > 0:
+                data.append(min(length, 15))
+                length -= min(length, 15)
+            pos = x
+        data.append(0)
+    return data
+
+
+def encode_alpha(mask, width, height, bpp):
+    """Encode the coverage of every pixel of an anti-aliased glyph with bpp bits (MSB first), every
+    row padded to a whole byte."""
+    max_value = (1 << bpp) - 1
+    row_bytes = (width * bpp + 7) // 8
+    data = [0 for _ in range(height * row_bytes)]  # noqa: F812
+    for y in range(height):
+        for x in range(width):
+            value = (mask.getpixel((x, y)) * max_value + 127) // 255
+            if not value:
+                continue
+            bit = x * bpp
+            data[y * row_bytes + bit // 8] |= value << (8 - bpp - bit % 8)
+    return data
 
 
 def to_code(config):
@@ -88,28 +171,46 @@ def to_code(config):
 
     ascent, descent = font.getmetrics()
 
+    bpp = config[CONF_BPP]
+    if bpp != 1:
+        glyph_encoding = GLYPH_ENCODING_ALPHA[bpp]
+        encode = functools.partial(encode_alpha, bpp=bpp)
+        mode = 'L'
+    else:
+        glyph_encoding = GLYPH_ENCODING[config[CONF_ENCODING]]
+        encode = encode_spans if config[CONF_ENCODING] == 'SPANS' else encode_bitmap
+        mode = '1'
     glyph_args = {}
     data = []
     for glyph in config[CONF_GLYPHS]:
-        mask = font.getmask(glyph, mode='1')
+        mask = font.getmask(glyph, mode=mode)
         _, (offset_x, offset_y) = font.font.getsize(glyph)
         width, height = mask.size
-        width8 = ((width + 7) // 8) * 8
-        glyph_data = [0 for _ in range(height * width8 // 8)]  # noqa: F812
-        for y in range(height):
-            for x in range(width):
-                if not mask.getpixel((x, y)):
-                    continue
-                pos = x + y * width8
-                glyph_data[pos // 8] |= 0x80 >> (pos % 8)
         glyph_args[glyph] = (len(data), offset_x, offset_y, width, height)
-        data += glyph_data
+        data += encode(mask, width, height)
 
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
 
     glyphs = []
     for glyph in config[CONF_GLYPHS]:
-        glyphs.append(Glyph(glyph, prog_arr, *glyph_args[glyph]))
-
-    cg.new_Pvariable(config[CONF_ID], glyphs, ascent, ascent + descent)
+        glyphs.append(Glyph(glyph, prog_arr, *glyph_args[glyph], glyph_encoding))
+
+    var = cg.new_Pvariable(config[CONF_ID], glyphs, ascent, ascent + descent)
+
+    if all(len(glyph) == 1 for glyph in config[CONF_GLYPHS]):
+        # Glyphs of single characters can be found by their codepoint, the glyphs are sorted by their
+        # UTF-8 encoding, which is the same as sorting them by codepoint
+        ascii_index = [0xFF] * 128
+        codepoints = []
+        for i, glyph in enumerate(config[CONF_GLYPHS]):
+            if ord(glyph) < 0x80:
+                ascii_index[ord(glyph)] = i
+            else:
+                codepoints.append(ord(glyph))
+        ascii_arr = cg.progmem_array(config[CONF_ASCII_INDEX_ID], [HexInt(x) for x in ascii_index])
+        codepoints_arr = cg.nullptr
+        if codepoints:
+            codepoints_arr = cg.progmem_array(config[CONF_CODEPOINTS_ID],
+                                              [HexInt(x) for x in codepoints])
+        cg.add(var.set_glyph_index(ascii_arr, codepoints_arr, len(codepoints)))
@@ -2,7 +2,8 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
 from esphome.components import binary_sensor
-from esphome.const import CONF_ID, CONF_PIN
+from esphome.const import CONF_ID, CONF_NUMBER, CONF_PIN
+from esphome.core import CORE
 from .. import gpio_ns
 
 GPIOBinarySensor = gpio_ns.class_('GPIOBinarySensor', binary_sensor.BinarySensor, cg.Component)
@@ -20,3 +21,7 @@ def to_code(config):
 
     pin = yield cg.gpio_pin_expression(config[CONF_PIN])
     cg.add(var.set_pin(pin))
+    # Pins of I/O expanders and GPIO16 of the ESP8266 have no edge interrupts
+    internal = not any(key in config[CONF_PIN] for key in pins.PIN_SCHEMA_REGISTRY)
+    if internal and not (CORE.is_esp8266 and config[CONF_PIN][CONF_NUMBER] == 16):
+        cg.add(var.set_use_interrupt(True))
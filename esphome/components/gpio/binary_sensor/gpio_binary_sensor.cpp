@@ -9,6 +9,10 @@ static const char *TAG = "gpio.binary_sensor";
 void GPIOBinarySensor::setup() {
   this->pin_->setup();
   this->publish_initial_state(this->pin_->digital_read());
+#ifdef USE_TICKLESS_LOOP
+  if (this->use_interrupt_)
+    this->pin_->attach_interrupt(GPIOBinarySensor::gpio_intr, this, CHANGE);
+#endif
 }
 
 void GPIOBinarySensor::dump_config() {
@@ -16,7 +20,16 @@ void GPIOBinarySensor::dump_config() {
   LOG_PIN("  Pin: ", this->pin_);
 }
 
-void GPIOBinarySensor::loop() { this->publish_state(this->pin_->digital_read()); }
+void GPIOBinarySensor::loop() {
+#ifdef USE_TICKLESS_LOOP
+  // An edge during the read below enables the loop again
+  if (this->use_interrupt_)
+    this->disable_loop();
+#endif
+  this->publish_state(this->pin_->digital_read());
+}
+
+void ICACHE_RAM_ATTR GPIOBinarySensor::gpio_intr(GPIOBinarySensor *arg) { arg->enable_loop(); }
 
 float GPIOBinarySensor::get_setup_priority() const { return setup_priority::HARDWARE; }
 
@@ -2,14 +2,18 @@
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
+#include <algorithm>
 
 namespace esphome {
 namespace ili9341 {
 
 static const char *TAG = "ili9341";
+/// The number of pixels converted to RGB565 at once before they are written to the bus.
+static const size_t ILI9341_TRANSFER_CHUNK_PIXELS = 128;
 
 void ILI9341Display::setup_pins_() {
   this->init_internal_(this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_ROWS, 8);
   this->dc_pin_->setup();  // OUTPUT
   this->dc_pin_->digital_write(false);
   if (this->reset_pin_ != nullptr) {
@@ -84,29 +88,27 @@ void ILI9341Display::update() {
 }
 
 void ILI9341Display::display_() {
-  // we will only update the changed window to the display
-  int w = this->x_high_ - this->x_low_ + 1;
-  int h = this->y_high_ - this->y_low_ + 1;
-
-  set_addr_window_(this->x_low_, this->y_low_, w, h);
-  this->start_data_();
-  uint32_t start_pos = ((this->y_low_ * this->width_) + x_low_);
-  for (uint16_t row = 0; row < h; row++) {
-    for (uint16_t col = 0; col < w; col++) {
-      uint32_t pos = start_pos + (row * width_) + col;
-
-      uint16_t color = convert_to_16bit_color_(buffer_[pos]);
-      this->write_byte(color >> 8);
-      this->write_byte(color);
+  // we will only update the changed regions to the display
+  for (auto &region : this->get_flush_regions_()) {
+    set_addr_window_(region.x1, region.y1, region.width(), region.height());
+    this->start_data_();
+    // the region is one continuous stream of pixels, convert and send it in chunks
+    alignas(4) uint16_t chunk[ILI9341_TRANSFER_CHUNK_PIXELS];
+    size_t pending = 0;
+    for (int y = region.y1; y <= region.y2; y++) {
+      const uint8_t *row = this->buffer_ + y * this->width_;
+      for (int x = region.x1; x <= region.x2; x++) {
+        chunk[pending++] = convert_to_16bit_color_(row[x]);
+        if (pending == ILI9341_TRANSFER_CHUNK_PIXELS) {
+          this->write_array16(chunk, pending);
+          pending = 0;
+        }
+      }
     }
+    if (pending > 0)
+      this->write_array16(chunk, pending);
+    this->end_data_();
   }
-  this->end_data_();
-
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 uint16_t ILI9341Display::convert_to_16bit_color_(uint8_t color_8bit) {
@@ -132,40 +134,60 @@ uint8_t ILI9341Display::convert_to_8bit_color_(uint16_t color_16bit) {
 void ILI9341Display::fill(Color color) {
   auto color565 = color.to_rgb_565();
   memset(this->buffer_, convert_to_8bit_color_(color565), this->get_buffer_length_());
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  this->mark_all_dirty_();
 }
 
 void ILI9341Display::fill_internal_(Color color) {
   this->set_addr_window_(0, 0, this->get_width_internal(), this->get_height_internal());
   this->start_data_();
 
-  auto color565 = color.to_rgb_565();
-  for (uint32_t i = 0; i < (this->get_width_internal()) * (this->get_height_internal()); i++) {
-    this->write_byte(color565 >> 8);
-    this->write_byte(color565);
-    buffer_[i] = 0;
+  alignas(4) uint16_t chunk[ILI9341_TRANSFER_CHUNK_PIXELS];
+  std::fill(chunk, chunk + ILI9341_TRANSFER_CHUNK_PIXELS, color.to_rgb_565());
+  size_t remaining = this->get_buffer_length_();
+  while (remaining > 0) {
+    const size_t pixels = std::min(remaining, ILI9341_TRANSFER_CHUNK_PIXELS);
+    this->write_array16(chunk, pixels);
+    remaining -= pixels;
   }
   this->end_data_();
+  memset(this->buffer_, 0, this->get_buffer_length_());
+  // the display matches the buffer now
+  this->dirty_regions_.clear();
 }
 
 void HOT ILI9341Display::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
 
-  // low and high watermark may speed up drawing from buffer
-  this->x_low_ = (x < this->x_low_) ? x : this->x_low_;
-  this->y_low_ = (y < this->y_low_) ? y : this->y_low_;
-  this->x_high_ = (x > this->x_high_) ? x : this->x_high_;
-  this->y_high_ = (y > this->y_high_) ? y : this->y_high_;
-
   uint32_t pos = (y * width_) + x;
   auto color565 = color.to_rgb_565();
   buffer_[pos] = convert_to_8bit_color_(color565);
 }
 
+void HOT ILI9341Display::blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha) {
+  if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
+    return;
+
+  uint8_t &pixel = this->buffer_[y * this->width_ + x];
+  pixel = display::blend_rgb332(convert_to_8bit_color_(color.to_rgb_565()), pixel, alpha);
+}
+
+void HOT ILI9341Display::fill_rect_internal(int x1, int y1, int width, int height, Color color) {
+  const uint8_t color8 = convert_to_8bit_color_(color.to_rgb_565());
+  for (int y = y1; y < y1 + height; y++)
+    memset(this->buffer_ + y * this->width_ + x1, color8, width);
+}
+
+void HOT ILI9341Display::blit_bitmap_internal(int x1, int y1, const uint8_t *data, int width, int height,
+                                              Color color) {
+  const uint8_t color8 = convert_to_8bit_color_(color.to_rgb_565());
+  uint8_t *start = this->buffer_ + y1 * this->width_ + x1;
+  const int stride = this->width_;
+  display::for_each_bitmap_pixel(data, width, height, [start, stride, color8](int x, int y) {
+    start[y * stride + x] = color8;
+  });
+}
+
 // should return the total size: return this->get_width_internal() * this->get_height_internal() * 2 // 16bit color
 // values per bit is huge
 uint32_t ILI9341Display::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal(); }
@@ -198,18 +220,14 @@ void ILI9341Display::init_lcd_(const uint8_t *init_cmd) {
 void ILI9341Display::set_addr_window_(uint16_t x1, uint16_t y1, uint16_t w, uint16_t h) {
   uint16_t x2 = (x1 + w - 1), y2 = (y1 + h - 1);
   this->command(ILI9341_CASET);  // Column address set
+  alignas(4) const uint16_t columns[2] = {x1, x2};
   this->start_data_();
-  this->write_byte(x1 >> 8);
-  this->write_byte(x1);
-  this->write_byte(x2 >> 8);
-  this->write_byte(x2);
+  this->write_array16(columns, 2);
   this->end_data_();
   this->command(ILI9341_PASET);  // Row address set
+  alignas(4) const uint16_t rows[2] = {y1, y2};
   this->start_data_();
-  this->write_byte(y1 >> 8);
-  this->write_byte(y1);
-  this->write_byte(y2 >> 8);
-  this->write_byte(y2);
+  this->write_array16(rows, 2);
   this->end_data_();
   this->command(ILI9341_RAMWR);  // Write to RAM
 }
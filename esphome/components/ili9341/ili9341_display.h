@@ -43,6 +43,9 @@ class ILI9341Display : public PollingComponent,
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha) override;
+  void fill_rect_internal(int x1, int y1, int width, int height, Color color) override;
+  void blit_bitmap_internal(int x1, int y1, const uint8_t *data, int width, int height, Color color) override;
   void setup_pins_();
 
   void init_lcd_(const uint8_t *init_cmd);
@@ -57,10 +60,6 @@ class ILI9341Display : public PollingComponent,
   ILI9341Model model_;
   int16_t width_{320};   ///< Display width as modified by current rotation
   int16_t height_{240};  ///< Display height as modified by current rotation
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
 
   uint32_t get_buffer_length_();
   int get_width_internal() override;
@@ -17,6 +17,7 @@ IMAGE_TYPE = {
     'BINARY': ImageType.IMAGE_TYPE_BINARY,
     'GRAYSCALE': ImageType.IMAGE_TYPE_GRAYSCALE,
     'RGB24': ImageType.IMAGE_TYPE_RGB24,
+    'RGBA': ImageType.IMAGE_TYPE_RGBA,
 }
 
 Image_ = display.display_ns.class_('Image')
@@ -77,6 +78,16 @@ def to_code(config):
             data[pos] = pix[2]
             pos += 1
 
+    elif config[CONF_TYPE] == 'RGBA':
+        image = image.convert('RGBA')
+        pixels = list(image.getdata())
+        data = [0 for _ in range(height * width * 4)]
+        pos = 0
+        for pix in pixels:
+            for channel in pix:
+                data[pos] = channel
+                pos += 1
+
     elif config[CONF_TYPE] == 'BINARY':
         image = image.convert('1', dither=dither)
         width8 = ((width + 7) // 8) * 8
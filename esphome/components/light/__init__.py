@@ -3,7 +3,7 @@ import esphome.config_validation as cv
 import esphome.automation as auto
 from esphome.components import mqtt, power_supply
 from esphome.const import CONF_COLOR_CORRECT, \
-    CONF_DEFAULT_TRANSITION_LENGTH, CONF_EFFECTS, CONF_GAMMA_CORRECT, CONF_ID, \
+    CONF_DEFAULT_TRANSITION_LENGTH, CONF_EFFECTS, CONF_FRAME_RATE, CONF_GAMMA_CORRECT, CONF_ID, \
     CONF_INTERNAL, CONF_NAME, CONF_MQTT_ID, CONF_POWER_SUPPLY, CONF_RESTORE_MODE, \
     CONF_ON_TURN_OFF, CONF_ON_TURN_ON, CONF_TRIGGER_ID
 from esphome.core import coroutine, coroutine_with_priority
@@ -57,6 +57,7 @@ ADDRESSABLE_LIGHT_SCHEMA = RGB_LIGHT_SCHEMA.extend({
     cv.Optional(CONF_EFFECTS): validate_effects(ADDRESSABLE_EFFECTS),
     cv.Optional(CONF_COLOR_CORRECT): cv.All([cv.percentage], cv.Length(min=3, max=4)),
     cv.Optional(CONF_POWER_SUPPLY): cv.use_id(power_supply.PowerSupply),
+    cv.Optional(CONF_FRAME_RATE): cv.All(cv.frequency, cv.Range(min=1.0, max=1000.0)),
 })
 
 
@@ -86,6 +87,9 @@ def setup_light_core_(light_var, output_var, config):
         var_ = yield cg.get_variable(config[CONF_POWER_SUPPLY])
         cg.add(output_var.set_power_supply(var_))
 
+    if CONF_FRAME_RATE in config:
+        cg.add(output_var.set_frame_rate(config[CONF_FRAME_RATE]))
+
     if CONF_MQTT_ID in config:
         mqtt_ = cg.new_Pvariable(config[CONF_MQTT_ID], light_var)
         yield mqtt.register_mqtt_component(mqtt_, config)
@@ -97,6 +101,7 @@ def register_light(output_var, config):
     cg.add(cg.App.register_light(light_var))
     yield cg.register_component(light_var, config)
     yield setup_light_core_(light_var, output_var, config)
+    cg.add_object_id_hash(light_var, config[CONF_NAME])
 
 
 @coroutine_with_priority(100.0)
@@ -76,11 +76,7 @@ ESPColor ESPHSVColor::to_rgb() const {
   return rgb;
 }
 
-void ESPRangeView::set(const ESPColor &color) {
-  for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
-  }
-}
+void ESPRangeView::set(const ESPColor &color) { this->parent_->fill(this->begin_, this->size(), color); }
 ESPColorView ESPRangeView::operator[](int32_t index) const {
   index = interpret_index(index, this->size()) + this->begin_;
   return (*this->parent_)[index];
@@ -138,18 +134,7 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {
   if (rhs.begin_ == this->begin_)
     return *this;
 
-  if (rhs.begin_ > this->begin_) {
-    // Copy from left
-    for (int32_t i = 0; i < this->size(); i++) {
-      (*this)[i].set(rhs[i].get());
-    }
-  } else {
-    // Copy from right
-    for (int32_t i = this->size() - 1; i >= 0; i--) {
-      (*this)[i].set(rhs[i].get());
-    }
-  }
-
+  this->parent_->move_internal(this->begin_, rhs.begin_, this->size());
   return *this;
 }
 
@@ -161,6 +146,64 @@ int32_t HOT interpret_index(int32_t index, int32_t size) {
   return index;
 }
 
+void AddressableLight::write_range_internal(int32_t start, const ESPColor *colors, int32_t count, bool write_white) {
+  for (int32_t i = 0; i < count; i++) {
+    if (write_white)
+      this->get_view_internal(start + i).set(colors[i]);
+    else
+      this->get_view_internal(start + i).set_rgb(colors[i].r, colors[i].g, colors[i].b);
+  }
+}
+void AddressableLight::fill_internal(int32_t start, int32_t count, const ESPColor &color) {
+  for (int32_t i = start; i < start + count; i++)
+    this->get_view_internal(i).set(color);
+}
+void AddressableLight::move_internal(int32_t dst, int32_t src, int32_t count) {
+  if (src > dst) {
+    // Copy from left
+    for (int32_t i = 0; i < count; i++)
+      this->get_view_internal(dst + i).set(this->get_view_internal(src + i).get());
+  } else {
+    // Copy from right
+    for (int32_t i = count - 1; i >= 0; i--)
+      this->get_view_internal(dst + i).set(this->get_view_internal(src + i).get());
+  }
+}
+void AddressableLight::rotate_internal(int32_t amnt) {
+  std::vector<ESPColor> head;
+  head.reserve(amnt);
+  for (int32_t i = 0; i < amnt; i++)
+    head.push_back(this->get_view_internal(i).get());
+  this->move_internal(0, amnt, this->size() - amnt);
+  this->write_range_internal(this->size() - amnt, head.data(), amnt, true);
+}
+
+void AddressableLight::record_show_time_(uint32_t show_time_us) {
+  this->metrics_frames_++;
+  this->metrics_show_time_us_ += show_time_us;
+
+  const uint32_t now = millis();
+  const uint32_t elapsed = now - this->metrics_start_;
+  if (elapsed < 5000)
+    return;
+
+  this->frame_metrics_.frame_rate = this->metrics_frames_ * 1000.0f / elapsed;
+  this->frame_metrics_.render_time_us =
+      this->metrics_renders_ == 0 ? 0 : this->metrics_render_time_us_ / this->metrics_renders_;
+  this->frame_metrics_.show_time_us = this->metrics_show_time_us_ / this->metrics_frames_;
+#ifdef ESPHOME_LOG_HAS_VERBOSE
+  const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
+  ESP_LOGV(TAG, "Addressable Light '%s': %.1f fps, render %u us, show %u us", name, this->frame_metrics_.frame_rate,
+           this->frame_metrics_.render_time_us, this->frame_metrics_.show_time_us);
+#endif
+
+  this->metrics_start_ = now;
+  this->metrics_frames_ = 0;
+  this->metrics_renders_ = 0;
+  this->metrics_render_time_us_ = 0;
+  this->metrics_show_time_us_ = 0;
+}
+
 void AddressableLight::call_setup() {
   this->setup();
 
@@ -195,8 +238,11 @@ void AddressableLight::write_state(LightState *state) {
   this->last_transition_progress_ = 0.0f;
   this->accumulated_alpha_ = 0.0f;
 
-  if (this->is_effect_active())
+  if (this->is_effect_active()) {
+    // show the new brightness also when the effect only shows on new frames
+    this->schedule_show();
     return;
+  }
 
   // don't use LightState helper, gamma correction+brightness is handled by ESPColorView
 
@@ -263,6 +309,8 @@ void ESPColorCorrection::calculate_gamma_table(float gamma) {
     auto corrected = static_cast<uint8_t>(roundf(255.0f * gamma_correct(i / 255.0f, gamma)));
     this->gamma_table_[i] = corrected;
   }
+  this->correct_local_brightness_ = -1;
+  this->uncorrect_local_brightness_ = -1;
   if (gamma == 0.0f) {
     for (uint16_t i = 0; i < 256; i++)
       this->gamma_reverse_table_[i] = i;
@@ -275,5 +323,54 @@ void ESPColorCorrection::calculate_gamma_table(float gamma) {
   }
 }
 
+void ESPColorCorrection::calculate_correct_table_() const {
+  for (uint16_t i = 0; i < 256; i++) {
+    for (uint8_t channel = 0; channel < 3; channel++) {
+      uint8_t res = esp_scale8(esp_scale8(i, this->max_brightness_.raw[channel]), this->local_brightness_);
+      this->correct_table_[channel][i] = this->gamma_table_[res];
+    }
+    // do not scale white value with brightness
+    this->correct_table_[3][i] = this->gamma_table_[esp_scale8(i, this->max_brightness_.white)];
+  }
+  this->correct_max_brightness_ = this->max_brightness_;
+  this->correct_local_brightness_ = this->local_brightness_;
+}
+
+void ESPColorCorrection::calculate_uncorrect_table_() const {
+  for (uint8_t channel = 0; channel < 4; channel++) {
+    const uint8_t max_brightness = this->max_brightness_.raw[channel];
+    // white is not scaled by brightness
+    const uint8_t local_brightness = channel == 3 ? 255 : this->local_brightness_;
+    for (uint16_t i = 0; i < 256; i++) {
+      if (max_brightness == 0 || local_brightness == 0) {
+        this->uncorrect_table_[channel][i] = 0;
+        continue;
+      }
+      uint16_t uncorrected = this->gamma_reverse_table_[i] * 255UL;
+      if (channel == 3) {
+        this->uncorrect_table_[channel][i] = uncorrected / max_brightness;
+      } else {
+        this->uncorrect_table_[channel][i] = ((uncorrected / max_brightness) * 255UL) / local_brightness;
+      }
+    }
+  }
+  this->uncorrect_max_brightness_ = this->max_brightness_;
+  this->uncorrect_local_brightness_ = this->local_brightness_;
+}
+
+void HOT ESPColorCorrection::color_correct_range(const ESPColor *colors, int32_t count, uint8_t *out, size_t stride,
+                                                 const uint8_t *offsets, uint8_t channels) const {
+  this->update_correct_table_();
+  // offsets only has a white entry for LEDs with a white channel
+  const uint8_t red = offsets[0], green = offsets[1], blue = offsets[2], white = channels > 3 ? offsets[3] : 0;
+  for (int32_t i = 0; i < count; i++, out += stride) {
+    out[red] = this->correct_table_[0][colors[i].red];
+    out[green] = this->correct_table_[1][colors[i].green];
+    out[blue] = this->correct_table_[2][colors[i].blue];
+    if (channels > 3)
+      out[white] = this->correct_table_[3][colors[i].white];
+  }
+}
+
 }  // namespace light
 }  // namespace esphome
@@ -192,65 +192,90 @@ class ESPColorCorrection {
   void calculate_gamma_table(float gamma);
   inline ESPColor color_correct(ESPColor color) const ALWAYS_INLINE {
     // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
-    return ESPColor(this->color_correct_red(color.red), this->color_correct_green(color.green),
-                    this->color_correct_blue(color.blue), this->color_correct_white(color.white));
+    this->update_correct_table_();
+    return ESPColor(this->correct_table_[0][color.red], this->correct_table_[1][color.green],
+                    this->correct_table_[2][color.blue], this->correct_table_[3][color.white]);
   }
   inline uint8_t color_correct_red(uint8_t red) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(red, this->max_brightness_.red), this->local_brightness_);
-    return this->gamma_table_[res];
+    this->update_correct_table_();
+    return this->correct_table_[0][red];
   }
   inline uint8_t color_correct_green(uint8_t green) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(green, this->max_brightness_.green), this->local_brightness_);
-    return this->gamma_table_[res];
+    this->update_correct_table_();
+    return this->correct_table_[1][green];
   }
   inline uint8_t color_correct_blue(uint8_t blue) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(blue, this->max_brightness_.blue), this->local_brightness_);
-    return this->gamma_table_[res];
+    this->update_correct_table_();
+    return this->correct_table_[2][blue];
   }
   inline uint8_t color_correct_white(uint8_t white) const ALWAYS_INLINE {
     // do not scale white value with brightness
-    uint8_t res = esp_scale8(white, this->max_brightness_.white);
-    return this->gamma_table_[res];
-  }
+    this->update_correct_table_();
+    return this->correct_table_[3][white];
+  }
+  /** Color correct count colors into an LED buffer.
+   *
+   * @param colors The uncorrected colors.
+   * @param count The number of colors.
+   * @param out The first LED in the buffer.
+   * @param stride The number of bytes per LED in the buffer.
+   * @param offsets The offset of the red, green, blue and white channel within an LED, the white one is only read if
+   * channels is 4.
+   * @param channels The number of channels per LED, 3 skips the white channel.
+   */
+  void color_correct_range(const ESPColor *colors, int32_t count, uint8_t *out, size_t stride, const uint8_t *offsets,
+                           uint8_t channels) const;
   inline ESPColor color_uncorrect(ESPColor color) const ALWAYS_INLINE {
     // uncorrected = corrected^(1/gamma) / (max_brightness * local_brightness)
-    return ESPColor(this->color_uncorrect_red(color.red), this->color_uncorrect_green(color.green),
-                    this->color_uncorrect_blue(color.blue), this->color_uncorrect_white(color.white));
+    this->update_uncorrect_table_();
+    return ESPColor(this->uncorrect_table_[0][color.red], this->uncorrect_table_[1][color.green],
+                    this->uncorrect_table_[2][color.blue], this->uncorrect_table_[3][color.white]);
   }
   inline uint8_t color_uncorrect_red(uint8_t red) const ALWAYS_INLINE {
-    if (this->max_brightness_.red == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[red] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.red) * 255UL) / this->local_brightness_;
-    return res;
+    this->update_uncorrect_table_();
+    return this->uncorrect_table_[0][red];
   }
   inline uint8_t color_uncorrect_green(uint8_t green) const ALWAYS_INLINE {
-    if (this->max_brightness_.green == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[green] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.green) * 255UL) / this->local_brightness_;
-    return res;
+    this->update_uncorrect_table_();
+    return this->uncorrect_table_[1][green];
   }
   inline uint8_t color_uncorrect_blue(uint8_t blue) const ALWAYS_INLINE {
-    if (this->max_brightness_.blue == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[blue] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.blue) * 255UL) / this->local_brightness_;
-    return res;
+    this->update_uncorrect_table_();
+    return this->uncorrect_table_[2][blue];
   }
   inline uint8_t color_uncorrect_white(uint8_t white) const ALWAYS_INLINE {
-    if (this->max_brightness_.white == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[white] * 255UL;
-    uint8_t res = uncorrected / this->max_brightness_.white;
-    return res;
+    this->update_uncorrect_table_();
+    return this->uncorrect_table_[3][white];
   }
 
  protected:
+  // The correction tables fuse brightness and gamma of each channel into one lookup. Brightness changes with every
+  // transition step, so they are only rebuilt when they are used with a brightness they were not built for.
+  inline void update_correct_table_() const ALWAYS_INLINE {
+    if (this->correct_max_brightness_.raw_32 != this->max_brightness_.raw_32 ||
+        this->correct_local_brightness_ != this->local_brightness_)
+      this->calculate_correct_table_();
+  }
+  inline void update_uncorrect_table_() const ALWAYS_INLINE {
+    if (this->uncorrect_max_brightness_.raw_32 != this->max_brightness_.raw_32 ||
+        this->uncorrect_local_brightness_ != this->local_brightness_)
+      this->calculate_uncorrect_table_();
+  }
+  void calculate_correct_table_() const;
+  void calculate_uncorrect_table_() const;
+
   uint8_t gamma_table_[256];
   uint8_t gamma_reverse_table_[256];
   ESPColor max_brightness_;
   uint8_t local_brightness_{255};
+
+  mutable uint8_t correct_table_[4][256];
+  mutable uint8_t uncorrect_table_[4][256];
+  /// The brightness the tables were built for, -1 if they have to be rebuilt.
+  mutable ESPColor correct_max_brightness_;
+  mutable int16_t correct_local_brightness_{-1};
+  mutable ESPColor uncorrect_max_brightness_;
+  mutable int16_t uncorrect_local_brightness_{-1};
 };
 
 class ESPColorSettable {
@@ -356,6 +381,9 @@ class AddressableLight;
 
 int32_t interpret_index(int32_t index, int32_t size);
 
+/// The number of colors write_generated() buffers on the stack before handing them to write_range().
+static const int32_t ADDRESSABLE_LIGHT_CHUNK_SIZE = 32;
+
 class ESPRangeIterator;
 
 class ESPRangeView : public ESPColorSettable {
@@ -418,6 +446,13 @@ class ESPRangeIterator {
   int32_t i_;
 };
 
+/// Frame timing of an addressable light, averaged over the last few seconds.
+struct AddressableLightFrameMetrics {
+  float frame_rate;         ///< Frames shown per second.
+  uint32_t render_time_us;  ///< Time effects took to render a frame.
+  uint32_t show_time_us;    ///< Time writing a frame to the LEDs took.
+};
+
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
@@ -432,26 +467,78 @@ class AddressableLight : public LightOutput, public Component {
   ESPRangeView all() { return ESPRangeView(this, 0, this->size()); }
   ESPRangeIterator begin() { return this->all().begin(); }
   ESPRangeIterator end() { return this->all().end(); }
+  /** Set count LEDs starting at start to the given colors.
+   *
+   * The colors are color corrected like when they are set through an ESPColorView, but the output writes them to
+   * its LED buffer in one pass. LEDs outside of the strip are skipped. With write_white false only the red, green and
+   * blue channels are written and the white channel of the LEDs is left as it is, like ESPColorView::set_rgb().
+   */
+  void write_range(int32_t start, const ESPColor *colors, int32_t count, bool write_white = true) {
+    if (start < 0) {
+      colors -= start;
+      count += start;
+      start = 0;
+    }
+    count = std::min(count, this->size() - start);
+    if (count > 0)
+      this->write_range_internal(start, colors, count, write_white);
+  }
+  /// Set count LEDs starting at start to color.
+  void fill(int32_t start, int32_t count, const ESPColor &color) {
+    if (start < 0) {
+      count += start;
+      start = 0;
+    }
+    count = std::min(count, this->size() - start);
+    if (count > 0)
+      this->fill_internal(start, count, color);
+  }
+  /// Set count LEDs starting at start to the colors returned by func(index), in chunks through write_range().
+  template<typename F> void write_generated(int32_t start, int32_t count, F &&func, bool write_white = true) {
+    ESPColor chunk[ADDRESSABLE_LIGHT_CHUNK_SIZE];
+    while (count > 0) {
+      const int32_t chunk_size = std::min(count, ADDRESSABLE_LIGHT_CHUNK_SIZE);
+      for (int32_t i = 0; i < chunk_size; i++)
+        chunk[i] = func(start + i);
+      this->write_range(start, chunk, chunk_size, write_white);
+      start += chunk_size;
+      count -= chunk_size;
+    }
+  }
   void shift_left(int32_t amnt) {
     if (amnt < 0) {
       this->shift_right(-amnt);
       return;
     }
-    if (amnt > this->size())
-      amnt = this->size();
-    this->range(0, -amnt) = this->range(amnt, this->size());
+    if (amnt >= this->size())
+      return;
+    this->move_internal(0, amnt, this->size() - amnt);
   }
   void shift_right(int32_t amnt) {
     if (amnt < 0) {
       this->shift_left(-amnt);
       return;
     }
-    if (amnt > this->size())
-      amnt = this->size();
-    this->range(amnt, this->size()) = this->range(0, -amnt);
+    if (amnt >= this->size())
+      return;
+    this->move_internal(amnt, 0, this->size() - amnt);
   }
+  /// Rotate all LEDs by amnt towards the start of the strip, the first LEDs wrap around to the end.
+  void rotate_left(int32_t amnt) {
+    if (this->size() == 0)
+      return;
+    amnt %= this->size();
+    if (amnt < 0)
+      amnt += this->size();
+    if (amnt != 0)
+      this->rotate_internal(amnt);
+  }
+  /// Rotate all LEDs by amnt towards the end of the strip, the last LEDs wrap around to the start.
+  void rotate_right(int32_t amnt) { this->rotate_left(-amnt); }
   bool is_effect_active() const { return this->effect_active_; }
   void set_effect_active(bool effect_active) { this->effect_active_ = effect_active; }
+  /// Whether the active effect calls schedule_show() when it has a new frame, instead of showing on every loop.
+  void set_effect_schedules_show(bool effect_schedules_show) { this->effect_schedules_show_ = effect_schedules_show; }
   void write_state(LightState *state) override;
   void set_correction(float red, float green, float blue, float white = 1.0f) {
     this->correction_.set_max_brightness(ESPColor(uint8_t(roundf(red * 255.0f)), uint8_t(roundf(green * 255.0f)),
@@ -462,6 +549,21 @@ class AddressableLight : public LightOutput, public Component {
     this->state_parent_ = state;
   }
   void schedule_show() { this->next_show_ = true; }
+  /** Show frames at this rate, on a fixed schedule that doesn't depend on how long the loop takes. Effects then
+   * render each frame once, right after the previous one was shown. 0 shows as often as the loop runs.
+   */
+  void set_frame_rate(float frame_rate) {
+    this->frame_interval_us_ = frame_rate > 0.0f ? static_cast<uint32_t>(1000000.0f / frame_rate) : 0;
+  }
+  /// Whether an effect should render a new frame now.
+  bool is_frame_render_due() const { return this->frame_interval_us_ == 0 || !this->frame_rendered_; }
+  /// Called by effects after rendering a frame.
+  void frame_rendered(uint32_t render_time_us) {
+    this->frame_rendered_ = true;
+    this->metrics_renders_++;
+    this->metrics_render_time_us_ += render_time_us;
+  }
+  const AddressableLightFrameMetrics &get_frame_metrics() const { return this->frame_metrics_; }
 
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
@@ -470,9 +572,21 @@ class AddressableLight : public LightOutput, public Component {
   void call_setup() override;
 
  protected:
-  bool should_show_() const { return this->effect_active_ || this->next_show_; }
+  bool should_show_() const {
+    if (!(this->effect_active_ && !this->effect_schedules_show_) && !this->next_show_)
+      return false;
+    return this->frame_interval_us_ == 0 || micros() - this->frame_start_us_ >= this->frame_interval_us_;
+  }
   void mark_shown_() {
     this->next_show_ = false;
+    if (this->frame_interval_us_ != 0) {
+      this->frame_start_us_ += this->frame_interval_us_;
+      // more than a frame behind, start a new schedule instead of showing the missed frames back to back
+      const uint32_t now = micros();
+      if (now - this->frame_start_us_ >= this->frame_interval_us_)
+        this->frame_start_us_ = now;
+      this->frame_rendered_ = false;
+    }
 #ifdef USE_POWER_SUPPLY
     for (auto c : *this) {
       if (c.get().is_on()) {
@@ -483,9 +597,24 @@ class AddressableLight : public LightOutput, public Component {
     this->power_.unrequest();
 #endif
   }
+  /// Called by outputs after writing a frame to the LEDs.
+  void record_show_time_(uint32_t show_time_us);
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /** Bulk access for write_range(), fill(), shift_left()/shift_right() and rotate_left(). The ranges are already
+   * clipped to the strip. The default implementations go through get_view_internal(), outputs with an LED buffer
+   * should override them to work on it directly.
+   */
+  virtual void write_range_internal(int32_t start, const ESPColor *colors, int32_t count, bool write_white);
+  virtual void fill_internal(int32_t start, int32_t count, const ESPColor &color);
+  /// Copy count LEDs from src to dst, the ranges may overlap.
+  virtual void move_internal(int32_t dst, int32_t src, int32_t count);
+  /// Rotate all LEDs left by amnt, 0 < amnt < size().
+  virtual void rotate_internal(int32_t amnt);
+
+  friend ESPRangeView;
 
   bool effect_active_{false};
+  bool effect_schedules_show_{false};
   bool next_show_{true};
   ESPColorCorrection correction_{};
 #ifdef USE_POWER_SUPPLY
@@ -494,6 +623,15 @@ class AddressableLight : public LightOutput, public Component {
   LightState *state_parent_{nullptr};
   float last_transition_progress_{0.0f};
   float accumulated_alpha_{0.0f};
+  uint32_t frame_interval_us_{0};
+  uint32_t frame_start_us_{0};
+  bool frame_rendered_{false};
+  AddressableLightFrameMetrics frame_metrics_{};
+  uint32_t metrics_start_{0};
+  uint32_t metrics_frames_{0};
+  uint32_t metrics_renders_{0};
+  uint32_t metrics_render_time_us_{0};
+  uint32_t metrics_show_time_us_{0};
 };
 
 }  // namespace light
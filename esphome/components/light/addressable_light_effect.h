@@ -30,22 +30,36 @@ class AddressableLightEffect : public LightEffect {
   explicit AddressableLightEffect(const std::string &name) : LightEffect(name) {}
   void start_internal() override {
     this->get_addressable_()->set_effect_active(true);
+    this->get_addressable_()->set_effect_schedules_show(this->schedules_show_());
     this->get_addressable_()->clear_effect_data();
     this->start();
   }
-  void stop() override { this->get_addressable_()->set_effect_active(false); }
+  void stop() override {
+    this->get_addressable_()->set_effect_active(false);
+    this->get_addressable_()->set_effect_schedules_show(false);
+  }
   virtual void apply(AddressableLight &it, const ESPColor &current_color) = 0;
   void apply() override {
+    AddressableLight *it = this->get_addressable_();
+    // streams read their input on every loop and call schedule_show() for each complete frame
+    const bool paced = !this->schedules_show_();
+    if (paced && !it->is_frame_render_due())
+      return;
+    const uint32_t start = micros();
     LightColorValues color = this->state_->remote_values;
     // not using any color correction etc. that will be handled by the addressable layer
     ESPColor current_color =
         ESPColor(static_cast<uint8_t>(color.get_red() * 255), static_cast<uint8_t>(color.get_green() * 255),
                  static_cast<uint8_t>(color.get_blue() * 255), static_cast<uint8_t>(color.get_white() * 255));
-    this->apply(*this->get_addressable_(), current_color);
+    this->apply(*it, current_color);
+    if (paced)
+      it->frame_rendered(micros() - start);
   }
 
  protected:
   AddressableLight *get_addressable_() const { return (AddressableLight *) this->state_->get_output(); }
+  /// Whether this effect is fed by a stream and calls schedule_show() itself, instead of rendering once per frame.
+  virtual bool schedules_show_() const { return false; }
 };
 
 class AddressableLambdaLightEffect : public AddressableLightEffect {
@@ -80,11 +94,15 @@ class AddressableRainbowLightEffect : public AddressableLightEffect {
     hsv.saturation = 240;
     uint16_t hue = (millis() * this->speed_) % 0xFFFF;
     const uint16_t add = 0xFFFF / this->width_;
-    for (auto var : it) {
-      hsv.hue = hue >> 8;
-      var = hsv;
-      hue += add;
-    }
+    // like setting the LEDs to an ESPHSVColor, this leaves their white channel alone
+    it.write_generated(
+        0, it.size(),
+        [&hsv, &hue, add](int32_t) {
+          hsv.hue = hue >> 8;
+          hue += add;
+          return hsv.to_rgb();
+        },
+        false);
   }
   void set_speed(uint32_t speed) { this->speed_ = speed; }
   void set_width(uint16_t width) { this->width_ = width; }
@@ -151,9 +169,7 @@ class AddressableScanEffect : public AddressableLightEffect {
   void apply(AddressableLight &it, const ESPColor &current_color) override {
     it.all() = ESPColor::BLACK;
 
-    for (auto i = 0; i < this->scan_width_; i++) {
-      it[this->at_led_ + i] = current_color;
-    }
+    it.fill(this->at_led_, this->scan_width_, current_color);
 
     const uint32_t now = millis();
     if (now - this->last_move_ > this->move_interval_) {
@@ -189,19 +205,18 @@ class AddressableTwinkleEffect : public AddressableLightEffect {
       pos_add = pos_add32;
       this->last_progress_ += pos_add32 * this->progress_interval_;
     }
-    for (auto view : addressable) {
-      if (view.get_effect_data() != 0) {
-        const uint8_t sine = half_sin8(view.get_effect_data());
-        view = current_color * sine;
-        const uint8_t new_pos = view.get_effect_data() + pos_add;
-        if (new_pos < view.get_effect_data())
-          view.set_effect_data(0);
-        else
-          view.set_effect_data(new_pos);
-      } else {
-        view = ESPColor::BLACK;
-      }
-    }
+    addressable.write_generated(0, addressable.size(), [&](int32_t index) -> ESPColor {
+      auto view = addressable[index];
+      if (view.get_effect_data() == 0)
+        return ESPColor::BLACK;
+      const uint8_t sine = half_sin8(view.get_effect_data());
+      const uint8_t new_pos = view.get_effect_data() + pos_add;
+      if (new_pos < view.get_effect_data())
+        view.set_effect_data(0);
+      else
+        view.set_effect_data(new_pos);
+      return current_color * sine;
+    });
     while (random_float() < this->twinkle_probability_) {
       const size_t pos = random_uint32() % addressable.size();
       if (addressable[pos].get_effect_data() != 0)
@@ -229,25 +244,22 @@ class AddressableRandomTwinkleEffect : public AddressableLightEffect {
       this->last_progress_ = now;
     }
     uint8_t subsine = ((8 * (now - this->last_progress_)) / this->progress_interval_) & 0b111;
-    for (auto view : it) {
-      if (view.get_effect_data() != 0) {
-        const uint8_t x = (view.get_effect_data() >> 3) & 0b11111;
-        const uint8_t color = view.get_effect_data() & 0b111;
-        const uint16_t sine = half_sin8((x << 3) | subsine);
-        if (color == 0) {
-          view = current_color * sine;
-        } else {
-          view = ESPColor(((color >> 2) & 1) * sine, ((color >> 1) & 1) * sine, ((color >> 0) & 1) * sine);
-        }
-        const uint8_t new_x = x + pos_add;
-        if (new_x > 0b11111)
-          view.set_effect_data(0);
-        else
-          view.set_effect_data((new_x << 3) | color);
-      } else {
-        view = ESPColor(0, 0, 0, 0);
-      }
-    }
+    it.write_generated(0, it.size(), [&](int32_t index) -> ESPColor {
+      auto view = it[index];
+      if (view.get_effect_data() == 0)
+        return ESPColor(0, 0, 0, 0);
+      const uint8_t x = (view.get_effect_data() >> 3) & 0b11111;
+      const uint8_t color = view.get_effect_data() & 0b111;
+      const uint16_t sine = half_sin8((x << 3) | subsine);
+      const uint8_t new_x = x + pos_add;
+      if (new_x > 0b11111)
+        view.set_effect_data(0);
+      else
+        view.set_effect_data((new_x << 3) | color);
+      if (color == 0)
+        return current_color * sine;
+      return ESPColor(((color >> 2) & 1) * sine, ((color >> 1) & 1) * sine, ((color >> 0) & 1) * sine);
+    });
     while (random_float() < this->twinkle_probability_) {
       const size_t pos = random_uint32() % it.size();
       if (it[pos].get_effect_data() != 0)
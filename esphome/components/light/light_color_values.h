@@ -11,9 +11,63 @@
 namespace esphome {
 namespace light {
 
+/// Scale a 16-bit fixed point value (0 = 0.0, 65535 = 1.0) by another one, rounded to nearest.
+inline static uint16_t light_scale16(uint16_t value, uint16_t scale) {
+  const uint32_t product = uint32_t(value) * scale + 0x8000UL;
+  return (product + (product >> 16)) >> 16;
+}
+
+/// Linearly interpolate between two 16-bit fixed point values, completion 0 -> start, 65535 -> end.
+inline static uint16_t light_lerp16(uint16_t completion, uint16_t start, uint16_t end) {
+  if (end >= start)
+    return start + light_scale16(end - start, completion);
+  return start - light_scale16(start - end, completion);
+}
+
+/// The number of linear segments LightGammaTable approximates the gamma curve with.
+static const uint16_t LIGHT_GAMMA_TABLE_SEGMENTS = 64;
+
+/** Gamma correction of 16-bit fixed point values by table lookup.
+ *
+ * The curve is sampled at LIGHT_GAMMA_TABLE_SEGMENTS + 1 points and linearly interpolated in between, so that lights
+ * don't need a powf() call per channel for every update. Gamma values below 1 are too steep near zero to interpolate
+ * and keep using gamma_correct().
+ */
+class LightGammaTable {
+ public:
+  void set_gamma(float gamma) {
+    this->gamma_ = gamma;
+    for (uint16_t i = 0; i <= LIGHT_GAMMA_TABLE_SEGMENTS; i++) {
+      const float value = gamma_correct(i / float(LIGHT_GAMMA_TABLE_SEGMENTS), gamma);
+      this->table_[i] = static_cast<uint16_t>(roundf(value * 65535.0f));
+    }
+  }
+  float get_gamma() const { return this->gamma_; }
+
+  uint16_t correct(uint16_t value) const {
+    if (this->gamma_ <= 0.0f || this->gamma_ == 1.0f)
+      return value;
+    if (this->gamma_ < 1.0f)
+      return static_cast<uint16_t>(roundf(gamma_correct(value / 65535.0f, this->gamma_) * 65535.0f));
+    if (value == 65535)
+      return this->table_[LIGHT_GAMMA_TABLE_SEGMENTS];
+    // 65536 / LIGHT_GAMMA_TABLE_SEGMENTS = 1024 values per segment
+    const uint16_t segment = value >> 10;
+    const uint32_t offset = value & 0x3FF;
+    const uint16_t start = this->table_[segment];
+    const uint16_t end = this->table_[segment + 1];
+    return start + (((end - start) * offset + 0x200) >> 10);
+  }
+
+ protected:
+  float gamma_{0.0f};
+  uint16_t table_[LIGHT_GAMMA_TABLE_SEGMENTS + 1]{};
+};
+
 /** This class represents the color state for a light object.
  *
- * All values in this class are represented using floats in the range from 0.0 (off) to 1.0 (on).
+ * All values in this class are represented using floats in the range from 0.0 (off) to 1.0 (on), they are stored as
+ * 16-bit fixed point numbers so that transitions and the conversion to output levels don't need float math.
  * Not all values have to be populated though, for example a simple monochromatic light only needs
  * to access the state and brightness attributes.
  *
@@ -29,12 +83,12 @@ class LightColorValues {
  public:
   /// Construct the LightColorValues with all attributes enabled, but state set to 0.0
   LightColorValues()
-      : state_(0.0f),
-        brightness_(1.0f),
-        red_(1.0f),
-        green_(1.0f),
-        blue_(1.0f),
-        white_(1.0f),
+      : state_(0),
+        brightness_(65535),
+        red_(65535),
+        green_(65535),
+        blue_(65535),
+        white_(65535),
         color_temperature_{1.0f} {}
 
   LightColorValues(float state, float brightness, float red, float green, float blue, float white,
@@ -94,14 +148,24 @@ class LightColorValues {
    * @return The linearly interpolated LightColorValues.
    */
   static LightColorValues lerp(const LightColorValues &start, const LightColorValues &end, float completion) {
+    return LightColorValues::lerp_fixed(start, end, LightColorValues::to_fixed_(completion));
+  }
+
+  /// Like lerp(), with the completion as 16-bit fixed point value from 0 (start) to 65535 (end).
+  static LightColorValues lerp_fixed(const LightColorValues &start, const LightColorValues &end, uint16_t completion) {
     LightColorValues v;
-    v.set_state(esphome::lerp(completion, start.get_state(), end.get_state()));
-    v.set_brightness(esphome::lerp(completion, start.get_brightness(), end.get_brightness()));
-    v.set_red(esphome::lerp(completion, start.get_red(), end.get_red()));
-    v.set_green(esphome::lerp(completion, start.get_green(), end.get_green()));
-    v.set_blue(esphome::lerp(completion, start.get_blue(), end.get_blue()));
-    v.set_white(esphome::lerp(completion, start.get_white(), end.get_white()));
-    v.set_color_temperature(esphome::lerp(completion, start.get_color_temperature(), end.get_color_temperature()));
+    v.state_ = light_lerp16(completion, start.state_, end.state_);
+    v.brightness_ = light_lerp16(completion, start.brightness_, end.brightness_);
+    v.red_ = light_lerp16(completion, start.red_, end.red_);
+    v.green_ = light_lerp16(completion, start.green_, end.green_);
+    v.blue_ = light_lerp16(completion, start.blue_, end.blue_);
+    v.white_ = light_lerp16(completion, start.white_, end.white_);
+    if (start.color_temperature_ != end.color_temperature_) {
+      v.set_color_temperature(esphome::lerp(LightColorValues::from_fixed_(completion), start.color_temperature_,
+                                            end.color_temperature_));
+    } else {
+      v.color_temperature_ = start.color_temperature_;
+    }
     return v;
   }
 
@@ -171,29 +235,49 @@ class LightColorValues {
   }
 
   /// Convert these light color values to a binary representation and write them to binary.
-  void as_binary(bool *binary) const { *binary = this->state_ == 1.0f; }
+  void as_binary(bool *binary) const { *binary = this->state_ == 65535; }
 
   /// Convert these light color values to a brightness-only representation and write them to brightness.
   void as_brightness(float *brightness, float gamma = 0) const {
-    *brightness = gamma_correct(this->state_ * this->brightness_, gamma);
+    *brightness = gamma_correct(this->get_state() * this->get_brightness(), gamma);
+  }
+  /// Like as_brightness(), gamma corrected with a table.
+  void as_brightness(float *brightness, const LightGammaTable &gamma) const {
+    *brightness = from_fixed_(gamma.correct(light_scale16(this->state_, this->brightness_)));
   }
 
   /// Convert these light color values to an RGB representation and write them to red, green, blue.
   void as_rgb(float *red, float *green, float *blue, float gamma = 0, bool color_interlock = false) const {
-    float brightness = this->state_ * this->brightness_;
+    float brightness = this->get_state() * this->get_brightness();
+    if (color_interlock) {
+      brightness = brightness * (1.0f - this->get_white());
+    }
+    *red = gamma_correct(brightness * this->get_red(), gamma);
+    *green = gamma_correct(brightness * this->get_green(), gamma);
+    *blue = gamma_correct(brightness * this->get_blue(), gamma);
+  }
+  /// Like as_rgb(), in fixed point and gamma corrected with a table.
+  void as_rgb(float *red, float *green, float *blue, const LightGammaTable &gamma, bool color_interlock = false) const {
+    uint16_t brightness = light_scale16(this->state_, this->brightness_);
     if (color_interlock) {
-      brightness = brightness * (1.0f - this->white_);
+      brightness = light_scale16(brightness, 65535 - this->white_);
     }
-    *red = gamma_correct(brightness * this->red_, gamma);
-    *green = gamma_correct(brightness * this->green_, gamma);
-    *blue = gamma_correct(brightness * this->blue_, gamma);
+    *red = from_fixed_(gamma.correct(light_scale16(brightness, this->red_)));
+    *green = from_fixed_(gamma.correct(light_scale16(brightness, this->green_)));
+    *blue = from_fixed_(gamma.correct(light_scale16(brightness, this->blue_)));
   }
 
   /// Convert these light color values to an RGBW representation and write them to red, green, blue, white.
   void as_rgbw(float *red, float *green, float *blue, float *white, float gamma = 0,
                bool color_interlock = false) const {
     this->as_rgb(red, green, blue, gamma, color_interlock);
-    *white = gamma_correct(this->state_ * this->brightness_ * this->white_, gamma);
+    *white = gamma_correct(this->get_state() * this->get_brightness() * this->get_white(), gamma);
+  }
+  /// Like as_rgbw(), in fixed point and gamma corrected with a table.
+  void as_rgbw(float *red, float *green, float *blue, float *white, const LightGammaTable &gamma,
+               bool color_interlock = false) const {
+    this->as_rgb(red, green, blue, gamma, color_interlock);
+    *white = from_fixed_(gamma.correct(this->white_level_fixed_()));
   }
 
   /// Convert these light color values to an RGBWW representation with the given parameters.
@@ -201,33 +285,33 @@ class LightColorValues {
                 float *cold_white, float *warm_white, float gamma = 0, bool constant_brightness = false,
                 bool color_interlock = false) const {
     this->as_rgb(red, green, blue, gamma, color_interlock);
-    const float color_temp = clamp(this->color_temperature_, color_temperature_cw, color_temperature_ww);
-    const float ww_fraction = (color_temp - color_temperature_cw) / (color_temperature_ww - color_temperature_cw);
-    const float cw_fraction = 1.0f - ww_fraction;
-    const float white_level = gamma_correct(this->state_ * this->brightness_ * this->white_, gamma);
-    *cold_white = white_level * cw_fraction;
-    *warm_white = white_level * ww_fraction;
-    if (!constant_brightness) {
-      const float max_cw_ww = std::max(ww_fraction, cw_fraction);
-      *cold_white /= max_cw_ww;
-      *warm_white /= max_cw_ww;
-    }
+    const float white_level = gamma_correct(this->get_state() * this->get_brightness() * this->get_white(), gamma);
+    this->split_white_(color_temperature_cw, color_temperature_ww, white_level, cold_white, warm_white,
+                       constant_brightness);
+  }
+  /// Like as_rgbww(), in fixed point and gamma corrected with a table.
+  void as_rgbww(float color_temperature_cw, float color_temperature_ww, float *red, float *green, float *blue,
+                float *cold_white, float *warm_white, const LightGammaTable &gamma, bool constant_brightness = false,
+                bool color_interlock = false) const {
+    this->as_rgb(red, green, blue, gamma, color_interlock);
+    const float white_level = from_fixed_(gamma.correct(this->white_level_fixed_()));
+    this->split_white_(color_temperature_cw, color_temperature_ww, white_level, cold_white, warm_white,
+                       constant_brightness);
   }
 
   /// Convert these light color values to an CWWW representation with the given parameters.
   void as_cwww(float color_temperature_cw, float color_temperature_ww, float *cold_white, float *warm_white,
                float gamma = 0, bool constant_brightness = false) const {
-    const float color_temp = clamp(this->color_temperature_, color_temperature_cw, color_temperature_ww);
-    const float ww_fraction = (color_temp - color_temperature_cw) / (color_temperature_ww - color_temperature_cw);
-    const float cw_fraction = 1.0f - ww_fraction;
-    const float white_level = gamma_correct(this->state_ * this->brightness_ * this->white_, gamma);
-    *cold_white = white_level * cw_fraction;
-    *warm_white = white_level * ww_fraction;
-    if (!constant_brightness) {
-      const float max_cw_ww = std::max(ww_fraction, cw_fraction);
-      *cold_white /= max_cw_ww;
-      *warm_white /= max_cw_ww;
-    }
+    const float white_level = gamma_correct(this->get_state() * this->get_brightness() * this->get_white(), gamma);
+    this->split_white_(color_temperature_cw, color_temperature_ww, white_level, cold_white, warm_white,
+                       constant_brightness);
+  }
+  /// Like as_cwww(), in fixed point and gamma corrected with a table.
+  void as_cwww(float color_temperature_cw, float color_temperature_ww, float *cold_white, float *warm_white,
+               const LightGammaTable &gamma, bool constant_brightness = false) const {
+    const float white_level = from_fixed_(gamma.correct(this->white_level_fixed_()));
+    this->split_white_(color_temperature_cw, color_temperature_ww, white_level, cold_white, warm_white,
+                       constant_brightness);
   }
 
   /// Compare this LightColorValues to rhs, return true if and only if all attributes match.
@@ -238,38 +322,38 @@ class LightColorValues {
   bool operator!=(const LightColorValues &rhs) const { return !(rhs == *this); }
 
   /// Get the state of these light color values. In range from 0.0 (off) to 1.0 (on)
-  float get_state() const { return this->state_; }
+  float get_state() const { return from_fixed_(this->state_); }
   /// Get the binary true/false state of these light color values.
-  bool is_on() const { return this->get_state() != 0.0f; }
+  bool is_on() const { return this->state_ != 0; }
   /// Set the state of these light color values. In range from 0.0 (off) to 1.0 (on)
-  void set_state(float state) { this->state_ = clamp(state, 0.0f, 1.0f); }
+  void set_state(float state) { this->state_ = to_fixed_(state); }
   /// Set the state of these light color values as a binary true/false.
-  void set_state(bool state) { this->state_ = state ? 1.0f : 0.0f; }
+  void set_state(bool state) { this->state_ = state ? 65535 : 0; }
 
   /// Get the brightness property of these light color values. In range 0.0 to 1.0
-  float get_brightness() const { return this->brightness_; }
+  float get_brightness() const { return from_fixed_(this->brightness_); }
   /// Set the brightness property of these light color values. In range 0.0 to 1.0
-  void set_brightness(float brightness) { this->brightness_ = clamp(brightness, 0.0f, 1.0f); }
+  void set_brightness(float brightness) { this->brightness_ = to_fixed_(brightness); }
 
   /// Get the red property of these light color values. In range 0.0 to 1.0
-  float get_red() const { return this->red_; }
+  float get_red() const { return from_fixed_(this->red_); }
   /// Set the red property of these light color values. In range 0.0 to 1.0
-  void set_red(float red) { this->red_ = clamp(red, 0.0f, 1.0f); }
+  void set_red(float red) { this->red_ = to_fixed_(red); }
 
   /// Get the green property of these light color values. In range 0.0 to 1.0
-  float get_green() const { return this->green_; }
+  float get_green() const { return from_fixed_(this->green_); }
   /// Set the green property of these light color values. In range 0.0 to 1.0
-  void set_green(float green) { this->green_ = clamp(green, 0.0f, 1.0f); }
+  void set_green(float green) { this->green_ = to_fixed_(green); }
 
   /// Get the blue property of these light color values. In range 0.0 to 1.0
-  float get_blue() const { return this->blue_; }
+  float get_blue() const { return from_fixed_(this->blue_); }
   /// Set the blue property of these light color values. In range 0.0 to 1.0
-  void set_blue(float blue) { this->blue_ = clamp(blue, 0.0f, 1.0f); }
+  void set_blue(float blue) { this->blue_ = to_fixed_(blue); }
 
   /// Get the white property of these light color values. In range 0.0 to 1.0
-  float get_white() const { return white_; }
+  float get_white() const { return from_fixed_(this->white_); }
   /// Set the white property of these light color values. In range 0.0 to 1.0
-  void set_white(float white) { this->white_ = clamp(white, 0.0f, 1.0f); }
+  void set_white(float white) { this->white_ = to_fixed_(white); }
 
   /// Get the color temperature property of these light color values in mired.
   float get_color_temperature() const { return this->color_temperature_; }
@@ -279,12 +363,39 @@ class LightColorValues {
   }
 
  protected:
-  float state_;  ///< ON / OFF, float for transition
-  float brightness_;
-  float red_;
-  float green_;
-  float blue_;
-  float white_;
+  /// Convert a float from 0.0 to 1.0 to fixed point, clamping it to that range.
+  static uint16_t to_fixed_(float value) {
+    if (!(value > 0.0f))
+      return 0;
+    if (value >= 1.0f)
+      return 65535;
+    return static_cast<uint16_t>(value * 65535.0f + 0.5f);
+  }
+  static float from_fixed_(uint16_t value) { return value / 65535.0f; }
+
+  uint16_t white_level_fixed_() const {
+    return light_scale16(light_scale16(this->state_, this->brightness_), this->white_);
+  }
+  void split_white_(float color_temperature_cw, float color_temperature_ww, float white_level, float *cold_white,
+                    float *warm_white, bool constant_brightness) const {
+    const float color_temp = clamp(this->color_temperature_, color_temperature_cw, color_temperature_ww);
+    const float ww_fraction = (color_temp - color_temperature_cw) / (color_temperature_ww - color_temperature_cw);
+    const float cw_fraction = 1.0f - ww_fraction;
+    *cold_white = white_level * cw_fraction;
+    *warm_white = white_level * ww_fraction;
+    if (!constant_brightness) {
+      const float max_cw_ww = std::max(ww_fraction, cw_fraction);
+      *cold_white /= max_cw_ww;
+      *warm_white /= max_cw_ww;
+    }
+  }
+
+  uint16_t state_;  ///< ON / OFF, fractional for transitions
+  uint16_t brightness_;
+  uint16_t red_;
+  uint16_t green_;
+  uint16_t blue_;
+  uint16_t white_;
   float color_temperature_;  ///< Color Temperature in Mired
 };
 
@@ -336,6 +336,8 @@ class LightState : public Nameable, public Component {
   bool next_write_{true};
   /// Gamma correction factor for the light.
   float gamma_correct_{};
+  /// Lookup table for gamma_correct_, used when converting the current values for the output.
+  LightGammaTable gamma_table_;
   /// List of effects for this light.
   std::vector<LightEffect *> effects_;
 };
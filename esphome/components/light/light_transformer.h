@@ -33,6 +33,16 @@ class LightTransformer {
 
   float get_progress() { return clamp((millis() - this->start_time_) / float(this->length_), 0.0f, 1.0f); }
 
+  /// The progress of this transformation as 16-bit fixed point value, from 0 (start) to 65535 (finished).
+  uint16_t get_progress_fixed() {
+    const uint32_t elapsed = millis() - this->start_time_;
+    if (elapsed >= this->length_)
+      return 65535;
+    if (this->length_ < 65536UL)
+      return (elapsed * 65535UL + this->length_ / 2) / this->length_;
+    return (uint64_t(elapsed) * 65535ULL + this->length_ / 2) / this->length_;
+  }
+
  protected:
   const LightColorValues &get_start_values_() const { return this->start_values_; }
 
@@ -61,14 +71,23 @@ class LightTransitionTransformer : public LightTransformer {
   }
 
   LightColorValues get_values() override {
-    float v = LightTransitionTransformer::smoothed_progress(this->get_progress());
-    return LightColorValues::lerp(this->get_start_values_(), this->get_target_values_(), v);
+    uint16_t v = LightTransitionTransformer::smoothed_progress_fixed(this->get_progress_fixed());
+    return LightColorValues::lerp_fixed(this->get_start_values_(), this->get_target_values_(), v);
   }
 
   bool publish_at_end() override { return false; }
   bool is_transition() override { return true; }
 
   static float smoothed_progress(float x) { return x * x * x * (x * (x * 6.0f - 15.0f) + 10.0f); }
+  /// Like smoothed_progress(), with 16-bit fixed point values.
+  static uint16_t smoothed_progress_fixed(uint16_t x) {
+    const uint16_t x2 = light_scale16(x, x);
+    const uint16_t x3 = light_scale16(x2, x);
+    // 6x^2 - 15x + 10 is between 1 and 10 for x in [0, 1]
+    const uint32_t poly = 10UL * 65535UL - 15UL * x + 6UL * x2;
+    const uint32_t result = (uint64_t(x3) * poly + 32767ULL) / 65535ULL;
+    return result > 65535UL ? 65535 : result;
+  }
 };
 
 class LightFlashTransformer : public LightTransformer {
@@ -75,10 +75,13 @@ LoggerMessageTrigger = logger_ns.class_('LoggerMessageTrigger',
                                                                     cg.const_char_ptr))
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = 'esp8266_store_log_strings_in_flash'
+CONF_ASYNC_BUFFER_SIZE = 'async_buffer_size'
 CONFIG_SCHEMA = cv.All(cv.Schema({
     cv.GenerateID(): cv.declare_id(Logger),
     cv.Optional(CONF_BAUD_RATE, default=115200): cv.positive_int,
     cv.Optional(CONF_TX_BUFFER_SIZE, default=512): cv.validate_bytes,
+    # Record sizes in the ring buffer are 16 bit
+    cv.Optional(CONF_ASYNC_BUFFER_SIZE): cv.All(cv.validate_bytes, cv.int_range(max=32768)),
     cv.Optional(CONF_HARDWARE_UART, default='UART0'): uart_selection,
     cv.Optional(CONF_LEVEL, default='DEBUG'): is_log_level,
     cv.Optional(CONF_LOGS, default={}): cv.Schema({
@@ -101,6 +104,8 @@ def to_code(config):
                      config[CONF_TX_BUFFER_SIZE],
                      HARDWARE_UART_TO_UART_SELECTION[config[CONF_HARDWARE_UART]])
     log = cg.Pvariable(config[CONF_ID], rhs)
+    if CONF_ASYNC_BUFFER_SIZE in config:
+        cg.add(log.set_async_buffer_size(config[CONF_ASYNC_BUFFER_SIZE]))
     cg.add(log.pre_setup())
 
     for tag, level in config[CONF_LOGS].items():
@@ -0,0 +1,97 @@
+#include "binary_log.h"
+#include "esphome/core/helpers.h"
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+static void write_arg(const void *data, size_t len, uint8_t *out, size_t max, size_t &at) {
+  if (at < max)
+    memcpy(out + at, data, std::min(len, max - at));
+  at += len;
+}
+
+size_t HOT encode_log_args(const char *format, va_list args, uint8_t *out, size_t max) {
+  size_t at = 0;
+  const char *p = format;
+  while (*p != '\0') {
+    if (*p++ != '%')
+      continue;
+    if (*p == '%') {
+      p++;
+      continue;
+    }
+
+    // flags, width and precision
+    while (*p != '\0' && strchr("-+ #0123456789.*", *p) != nullptr) {
+      if (*p == '*') {
+        const int32_t value = va_arg(args, int);
+        write_arg(&value, sizeof(value), out, max, at);
+      }
+      p++;
+    }
+    // length modifier, only 64-bit integers change the size of an argument on this platform
+    bool is_64bit = false;
+    while (*p != '\0' && strchr("hlLqjzt", *p) != nullptr) {
+      if ((p[0] == 'l' && p[1] == 'l') || *p == 'q' || *p == 'j') {
+        is_64bit = true;
+        if (*p == 'l')
+          p++;
+      }
+      p++;
+    }
+
+    switch (*p) {
+      case 'd':
+      case 'i':
+      case 'u':
+      case 'o':
+      case 'x':
+      case 'X':
+      case 'c':
+        if (is_64bit) {
+          const uint64_t value = va_arg(args, unsigned long long);
+          write_arg(&value, sizeof(value), out, max, at);
+        } else {
+          const uint32_t value = va_arg(args, unsigned int);
+          write_arg(&value, sizeof(value), out, max, at);
+        }
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A': {
+        const double value = va_arg(args, double);
+        write_arg(&value, sizeof(value), out, max, at);
+        break;
+      }
+      case 's': {
+        const char *value = va_arg(args, const char *);
+        if (value == nullptr)
+          value = "(null)";
+        write_arg(value, strlen(value) + 1, out, max, at);
+        break;
+      }
+      case 'p':
+      case 'n': {
+        const uint32_t value = reinterpret_cast<uintptr_t>(va_arg(args, void *));
+        write_arg(&value, sizeof(value), out, max, at);
+        break;
+      }
+      case '\0':
+        return at;
+      default:
+        break;
+    }
+    p++;
+  }
+  return at;
+}
+
+}  // namespace logger
+}  // namespace esphome
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace logger {
+
+/** A log message in deferred-format binary form.
+ *
+ * Instead of the formatted text, only the address of the format string in the firmware image and the raw
+ * arguments are kept. The host looks up the format string in the firmware ELF file and formats the message
+ * itself (see esphome/binary_log.py), which saves the vsnprintf() call and most of the bytes on the wire.
+ */
+struct BinaryLogRecord {
+  int level;
+  const char *tag;
+  int line;
+  const char *format;
+  const uint8_t *args;
+  size_t args_len;
+};
+
+/** Serialize the printf arguments of format into out, in the order the format string consumes them.
+ *
+ * Integers are written as 4 bytes (8 for ll/j conversions), floating point values as 8 byte doubles and strings
+ * including their null terminator, all in the native (little endian) byte order. `*` widths and precisions are
+ * written as integers. Nothing past max bytes is written.
+ *
+ * @return The number of bytes needed for all arguments, which may be larger than max.
+ */
+size_t encode_log_args(const char *format, va_list args, uint8_t *out, size_t max);
+
+}  // namespace logger
+}  // namespace esphome
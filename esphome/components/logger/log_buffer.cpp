@@ -0,0 +1,123 @@
+#include "log_buffer.h"
+#include "esphome/core/helpers.h"
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+static const uint32_t RECORD_ALIGNMENT = 4;
+
+LogRingBuffer::LogRingBuffer(size_t capacity) {
+  uint32_t size = 1;
+  while (size * 2 <= capacity && size * 2 <= MAX_CAPACITY)
+    size *= 2;
+  // Zeroed memory reads as RECORD_EMPTY everywhere
+  this->data_ = new uint8_t[size]();
+  this->mask_ = size - 1;
+}
+
+LogRingBuffer::Record *HOT LogRingBuffer::reserve(size_t message_size) {
+  const uint32_t capacity = this->mask_ + 1;
+  uint32_t size = sizeof(Record) + message_size;
+  size = (size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+  if (size > capacity || size > UINT16_MAX) {
+    this->count_dropped_();
+    return nullptr;
+  }
+
+  uint32_t head;
+  uint32_t pad;
+#ifdef ARDUINO_ARCH_ESP32
+  head = __atomic_load_n(&this->head_, __ATOMIC_RELAXED);
+  do {
+    const uint32_t tail = __atomic_load_n(&this->tail_, __ATOMIC_ACQUIRE);
+    // Records are contiguous, skip the rest of the buffer if this one doesn't fit before the end
+    const uint32_t to_end = capacity - (head & this->mask_);
+    pad = to_end < size ? to_end : 0;
+    if (head + pad + size - tail > capacity) {
+      this->count_dropped_();
+      return nullptr;
+    }
+  } while (!__atomic_compare_exchange_n(&this->head_, &head, head + pad + size, true, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_RELAXED));
+#else
+  {
+    InterruptLock lock;
+    head = this->head_;
+    const uint32_t to_end = capacity - (head & this->mask_);
+    pad = to_end < size ? to_end : 0;
+    if (head + pad + size - this->tail_ > capacity) {
+      this->dropped_++;
+      return nullptr;
+    }
+    this->head_ = head + pad + size;
+  }
+#endif
+
+  if (pad >= sizeof(Record)) {
+    auto *padding = reinterpret_cast<Record *>(this->data_ + (head & this->mask_));
+    padding->size = pad;
+    __atomic_store_n(&padding->state, RECORD_PADDING, __ATOMIC_RELEASE);
+  }
+  // Smaller gaps at the end are skipped by the consumer without a header
+
+  auto *record = reinterpret_cast<Record *>(this->data_ + ((head + pad) & this->mask_));
+  record->size = size;
+  return record;
+}
+void HOT LogRingBuffer::commit(Record *record, LogRecordState state) {
+  __atomic_store_n(&record->state, state, __ATOMIC_RELEASE);
+}
+
+LogRingBuffer::Record *LogRingBuffer::peek(uint32_t end) {
+  const uint32_t capacity = this->mask_ + 1;
+  while (this->tail_ != end) {
+    const uint32_t offset = this->tail_ & this->mask_;
+    if (capacity - offset < sizeof(Record)) {
+      this->release_(capacity - offset);
+      continue;
+    }
+    auto *record = reinterpret_cast<Record *>(this->data_ + offset);
+    const uint8_t state = __atomic_load_n(&record->state, __ATOMIC_ACQUIRE);
+    if (state == RECORD_PADDING) {
+      this->release_(record->size);
+      continue;
+    }
+    if (state != RECORD_COMMITTED && state != RECORD_COMMITTED_BINARY) {
+      // Reserved but still being written to by its producer
+      return nullptr;
+    }
+    return record;
+  }
+  return nullptr;
+}
+void LogRingBuffer::pop(Record *record) { this->release_(record->size); }
+void LogRingBuffer::release_(uint32_t size) {
+  // Clear the space so that the next record header written here starts out as RECORD_EMPTY
+  memset(this->data_ + (this->tail_ & this->mask_), 0, size);
+  __atomic_store_n(&this->tail_, this->tail_ + size, __ATOMIC_RELEASE);
+}
+
+uint32_t LogRingBuffer::get_head() const { return __atomic_load_n(&this->head_, __ATOMIC_ACQUIRE); }
+bool LogRingBuffer::empty() const { return this->get_head() == this->tail_; }
+void LogRingBuffer::count_dropped_() {
+#ifdef ARDUINO_ARCH_ESP32
+  __atomic_fetch_add(&this->dropped_, 1, __ATOMIC_RELAXED);
+#else
+  InterruptLock lock;
+  this->dropped_++;
+#endif
+}
+uint32_t LogRingBuffer::take_dropped() {
+#ifdef ARDUINO_ARCH_ESP32
+  return __atomic_exchange_n(&this->dropped_, 0, __ATOMIC_RELAXED);
+#else
+  InterruptLock lock;
+  const uint32_t dropped = this->dropped_;
+  this->dropped_ = 0;
+  return dropped;
+#endif
+}
+
+}  // namespace logger
+}  // namespace esphome
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace logger {
+
+enum LogRecordState : uint8_t {
+  RECORD_EMPTY = 0,
+  RECORD_COMMITTED,
+  RECORD_COMMITTED_BINARY,
+  RECORD_PADDING,
+};
+
+/** A multi-producer, single-consumer ring buffer for formatted log records.
+ *
+ * Producers (any task, on the ESP32 also the BLE/camera tasks) reserve a contiguous record, format the message
+ * into it and then commit it. The main loop is the only consumer, it drains committed records in order and
+ * hands them to the serial port and the log callbacks.
+ *
+ * Space is reserved with a compare-and-swap on the ESP32 and with interrupts briefly disabled on the ESP8266
+ * (which has no atomic read-modify-write instructions). If a record does not fit, it is dropped and counted
+ * instead of blocking the caller.
+ */
+class LogRingBuffer {
+ public:
+  struct Record {
+    /// Size of this record in the ring, including this header and alignment padding.
+    uint16_t size;
+    uint8_t level;
+    /// One of the LogRecordState values, written last by the producer.
+    uint8_t state;
+    const char *tag;
+
+    char *message() { return reinterpret_cast<char *>(this + 1); }
+  };
+
+  /// Create a ring buffer, the capacity is rounded down to a power of two and limited to MAX_CAPACITY.
+  explicit LogRingBuffer(size_t capacity);
+  /// Record::size has to hold the padding record at the end of the ring, which can be almost as large as the ring.
+  static const uint32_t MAX_CAPACITY = 32768;
+
+  /** Reserve a record with room for message_size bytes (including the null terminator).
+   *
+   * @return The record to write the message to, or nullptr if the buffer is full.
+   */
+  Record *reserve(size_t message_size);
+  /// Publish a reserved record to the consumer, state tells it whether the record holds text or a binary message.
+  void commit(Record *record, LogRecordState state = RECORD_COMMITTED);
+
+  /// Get the oldest committed record that was reserved before position end, or nullptr.
+  Record *peek(uint32_t end);
+  /// Release the record returned by peek().
+  void pop(Record *record);
+
+  size_t get_capacity() const { return this->mask_ + 1; }
+
+  /// Get the current write position, used to bound a drain to the records that exist at this point.
+  uint32_t get_head() const;
+  bool empty() const;
+  /// Get and reset the number of records dropped because the buffer was full.
+  uint32_t take_dropped();
+
+ protected:
+  void release_(uint32_t size);
+  void count_dropped_();
+
+  uint8_t *data_;
+  uint32_t mask_;
+  uint32_t head_{0};
+  uint32_t tail_{0};
+  uint32_t dropped_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
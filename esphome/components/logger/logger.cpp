@@ -46,6 +46,16 @@ void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *
   if (level > this->level_for(tag))
     return;
 
+  if (this->binary_listeners_ != 0)
+    this->log_binary_(level, tag, line, format, format, args);
+  if (!this->has_text_listeners_())
+    return;
+
+  if (this->async_buffer_ != nullptr) {
+    this->log_async_(level, tag, line, format, args);
+    return;
+  }
+
   this->reset_buffer_();
   this->write_header_(level, tag, line);
   this->vprintf_to_buffer_(format, args);
@@ -70,6 +80,18 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
   if (this->is_buffer_full_())
     return;
 
+  // The binary message refers to the format string by its address in flash
+  if (this->binary_listeners_ != 0)
+    this->log_binary_(level, tag, line, (PGM_P) format, this->tx_buffer_, args);
+  if (!this->has_text_listeners_())
+    return;
+
+  if (this->async_buffer_ != nullptr) {
+    // The ESP8266 only logs from the main loop, so the copied format string in tx_buffer_ can't be overwritten
+    this->log_async_(level, tag, line, this->tx_buffer_, args);
+    return;
+  }
+
   // length of format string, includes null terminator
   uint32_t offset = this->tx_buffer_at_;
 
@@ -100,7 +122,9 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
   // make sure null terminator is present
   this->set_null_terminator_();
 
-  const char *msg = this->tx_buffer_ + offset;
+  this->dispatch_message_(level, tag, this->tx_buffer_ + offset);
+}
+void HOT Logger::dispatch_message_(int level, const char *tag, const char *msg) {
   if (this->baud_rate_ > 0)
     this->hw_serial_->println(msg);
 #ifdef ARDUINO_ARCH_ESP32
@@ -116,6 +140,115 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
 #endif
 }
 
+void HOT Logger::log_async_(int level, const char *tag, int line, const char *format, va_list args) {
+  if (level < 0)
+    level = 0;
+  if (level > 7)
+    level = 7;
+
+  const char *color = LOG_LEVEL_COLORS[level];
+  const char *letter = LOG_LEVEL_LETTERS[level];
+  const size_t footer_len = strlen(ESPHOME_LOG_RESET_COLOR);
+
+  // Format once on the stack, so that only the space the message needs is reserved in the buffer
+  char msg[ASYNC_FORMAT_BUFFER_SIZE];
+  const size_t max_len = std::min<size_t>(this->tx_buffer_size_, sizeof(msg) - 1);
+  int ret = snprintf(msg, max_len + 1, "%s[%s][%s:%03u]: ", color, letter, tag, line);
+  if (ret < 0)
+    return;
+  size_t at = std::min<size_t>(ret, max_len);
+  if (at < max_len) {
+    ret = vsnprintf(msg + at, max_len + 1 - at, format, args);
+    if (ret < 0)
+      return;
+    at = std::min<size_t>(at + ret, max_len);
+  }
+  const size_t footer_at = std::min(footer_len, max_len - at);
+  memcpy(msg + at, ESPHOME_LOG_RESET_COLOR, footer_at);
+  at += footer_at;
+  // remove trailing newline
+  if (at > 0 && msg[at - 1] == '\n')
+    at--;
+  msg[at] = '\0';
+
+  auto *record = this->async_buffer_->reserve(at + 1);
+  if (record == nullptr)
+    return;
+  memcpy(record->message(), msg, at + 1);
+  record->level = level;
+  record->tag = tag;
+  this->async_buffer_->commit(record);
+  this->enable_loop();
+}
+/// Header of binary messages in the async buffer, followed by the encoded arguments.
+struct AsyncBinaryHeader {
+  int32_t line;
+  const char *format;
+};
+
+void HOT Logger::log_binary_(int level, const char *tag, int line, const char *format_id, const char *format,
+                             va_list args) {
+  va_list args_copy;
+  if (this->async_buffer_ == nullptr) {
+    va_copy(args_copy, args);
+    size_t len = encode_log_args(format, args_copy, this->binary_buffer_, this->tx_buffer_size_);
+    va_end(args_copy);
+    len = std::min<size_t>(len, this->tx_buffer_size_);
+    BinaryLogRecord record{level, tag, line, format_id, this->binary_buffer_, len};
+    this->dispatch_binary_message_(record);
+    return;
+  }
+
+  va_copy(args_copy, args);
+  const size_t len = std::min<size_t>(encode_log_args(format, args_copy, nullptr, 0), this->tx_buffer_size_);
+  va_end(args_copy);
+  auto *record = this->async_buffer_->reserve(sizeof(AsyncBinaryHeader) + len);
+  if (record == nullptr)
+    return;
+  auto *header = reinterpret_cast<AsyncBinaryHeader *>(record->message());
+  header->line = line;
+  header->format = format_id;
+  va_copy(args_copy, args);
+  encode_log_args(format, args_copy, reinterpret_cast<uint8_t *>(header + 1), len);
+  va_end(args_copy);
+  record->level = level;
+  record->tag = tag;
+  this->async_buffer_->commit(record, RECORD_COMMITTED_BINARY);
+  this->enable_loop();
+}
+void HOT Logger::dispatch_binary_message_(const BinaryLogRecord &record) {
+#ifdef ARDUINO_ARCH_ESP32
+  // Same as for text messages, see dispatch_message_()
+  if (xPortGetFreeHeapSize() <= 2048)
+    return;
+#endif
+  this->binary_log_callback_.call(record);
+}
+void Logger::drain_async_buffer_() {
+  // Only write out what is in the buffer now, messages logged by the callbacks are handled in the next loop
+  const uint32_t end = this->async_buffer_->get_head();
+  LogRingBuffer::Record *record;
+  while ((record = this->async_buffer_->peek(end)) != nullptr) {
+    if (record->state == RECORD_COMMITTED_BINARY) {
+      auto *header = reinterpret_cast<AsyncBinaryHeader *>(record->message());
+      auto *args = reinterpret_cast<const uint8_t *>(header + 1);
+      const size_t args_len = record->size - sizeof(LogRingBuffer::Record) - sizeof(AsyncBinaryHeader);
+      BinaryLogRecord binary{record->level, record->tag, header->line, header->format, args, args_len};
+      this->dispatch_binary_message_(binary);
+    } else {
+      this->dispatch_message_(record->level, record->tag, record->message());
+    }
+    this->async_buffer_->pop(record);
+  }
+  // Another task may still be writing its record, try again in the next loop
+  if (!this->async_buffer_->empty())
+    this->enable_loop();
+
+  const uint32_t dropped = this->async_buffer_->take_dropped();
+  if (dropped != 0)
+    ESP_LOGW(TAG, "Dropped %u log messages because the async log buffer was full", dropped);
+}
+
 Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size, UARTSelection uart)
     : baud_rate_(baud_rate), tx_buffer_size_(tx_buffer_size), uart_(uart) {
   // add 1 to buffer size for null terminator
@@ -165,14 +298,38 @@ void Logger::pre_setup() {
 
   ESP_LOGI(TAG, "Log initialized");
 }
+void Logger::loop() {
+  // Disabled before draining, so that anything logged from here on enables the loop again
+  this->disable_loop();
+  if (this->async_buffer_ != nullptr)
+    this->drain_async_buffer_();
+}
+void Logger::on_shutdown() {
+  if (this->async_buffer_ != nullptr)
+    this->drain_async_buffer_();
+}
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
+void Logger::set_async_buffer_size(size_t size) { this->async_buffer_ = new LogRingBuffer(size); }
 void Logger::set_log_level(const std::string &tag, int log_level) {
   this->log_levels_.push_back(LogLevelOverride{tag, log_level});
 }
 UARTSelection Logger::get_uart() const { return this->uart_; }
-void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
+void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback, bool on_demand) {
+  if (!on_demand)
+    this->text_listeners_++;
   this->log_callback_.add(std::move(callback));
 }
+void Logger::add_on_binary_log_callback(std::function<void(const BinaryLogRecord &)> &&callback) {
+  this->binary_log_callback_.add(std::move(callback));
+}
+void Logger::add_text_listener() { this->text_listeners_++; }
+void Logger::remove_text_listener() { this->text_listeners_--; }
+void Logger::add_binary_listener() {
+  if (this->binary_buffer_ == nullptr)
+    this->binary_buffer_ = new uint8_t[this->tx_buffer_size_];
+  this->binary_listeners_++;
+}
+void Logger::remove_binary_listener() { this->binary_listeners_--; }
 float Logger::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 const char *LOG_LEVELS[] = {"NONE", "ERROR", "WARN", "INFO", "CONFIG", "DEBUG", "VERBOSE", "VERY_VERBOSE"};
 #ifdef ARDUINO_ARCH_ESP32
@@ -186,6 +343,9 @@ void Logger::dump_config() {
   ESP_LOGCONFIG(TAG, "  Level: %s", LOG_LEVELS[ESPHOME_LOG_LEVEL]);
   ESP_LOGCONFIG(TAG, "  Log Baud Rate: %u", this->baud_rate_);
   ESP_LOGCONFIG(TAG, "  Hardware UART: %s", UART_SELECTIONS[this->uart_]);
+  if (this->async_buffer_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Async Buffer Size: %u bytes", this->async_buffer_->get_capacity());
+  }
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
@@ -5,6 +5,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/defines.h"
+#include "log_buffer.h"
+#include "binary_log.h"
 
 namespace esphome {
 
@@ -40,6 +42,14 @@ class Logger : public Component {
   /// Set the log level of the specified tag.
   void set_log_level(const std::string &tag, int log_level);
 
+  /** Buffer log messages and write them out from the main loop instead of in the log call.
+   *
+   * Log calls then only format the message into a ring buffer of this size and return, which makes them
+   * safe to use from other tasks. Messages that don't fit into the buffer are dropped and counted. Each message is
+   * formatted on the stack of the logging task first and cut off after ASYNC_FORMAT_BUFFER_SIZE - 1 characters.
+   */
+  void set_async_buffer_size(size_t size);
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Set up this component.
@@ -48,11 +58,26 @@ class Logger : public Component {
 
   int level_for(const char *tag);
 
-  /// Register a callback that will be called for every log message sent
-  void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback);
+  /** Register a callback that will be called for every log message sent.
+   *
+   * Messages are only formatted as text while something consumes them. With on_demand set, this callback doesn't
+   * count as a consumer by itself and only receives messages while add_text_listener() is in effect (or the serial
+   * port or another callback needs them).
+   */
+  void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback, bool on_demand = false);
+  /// Register a callback for log messages in deferred-format binary form, only called while there are binary listeners.
+  void add_on_binary_log_callback(std::function<void(const BinaryLogRecord &)> &&callback);
+
+  void add_text_listener();
+  void remove_text_listener();
+  void add_binary_listener();
+  void remove_binary_listener();
 
   float get_setup_priority() const override;
 
+  void loop() override;
+  void on_shutdown() override;
+
   void log_vprintf_(int level, const char *tag, int line, const char *format, va_list args);  // NOLINT
 #ifdef USE_STORE_LOG_STR_IN_FLASH
   void log_vprintf_(int level, const char *tag, int line, const __FlashStringHelper *format, va_list args);  // NOLINT
@@ -62,6 +87,14 @@ class Logger : public Component {
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
+  void dispatch_message_(int level, const char *tag, const char *msg);
+  void log_binary_(int level, const char *tag, int line, const char *format_id, const char *format, va_list args);
+  void dispatch_binary_message_(const BinaryLogRecord &record);
+  bool has_text_listeners_() const { return this->baud_rate_ > 0 || this->text_listeners_ != 0; }
+  void log_async_(int level, const char *tag, int line, const char *format, va_list args);
+  /// Size of the stack buffer log_async_() formats a message into, kept small for the stacks of other tasks.
+  static const size_t ASYNC_FORMAT_BUFFER_SIZE = 256;
+  void drain_async_buffer_();
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -107,12 +140,17 @@ class Logger : public Component {
   int tx_buffer_size_{0};
   UARTSelection uart_{UART_SELECTION_UART0};
   HardwareSerial *hw_serial_{nullptr};
+  LogRingBuffer *async_buffer_{nullptr};
   struct LogLevelOverride {
     std::string tag;
     int level;
   };
   std::vector<LogLevelOverride> log_levels_;
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
+  CallbackManager<void(const BinaryLogRecord &)> binary_log_callback_{};
+  uint8_t *binary_buffer_{nullptr};
+  uint8_t text_listeners_{0};
+  uint8_t binary_listeners_{0};
 };
 
 extern Logger *global_logger;
@@ -83,11 +83,17 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   void loop() override {
     if (!this->should_show_())
       return;
+    // with a frame rate, don't block in Show() while the previous frame is still being sent (DMA, RMT and UART
+    // methods), effects keep rendering into the pixel buffer meanwhile
+    if (this->frame_interval_us_ != 0 && !this->controller_->CanShow())
+      return;
 
     this->mark_shown_();
     this->controller_->Dirty();
 
+    const uint32_t start = micros();
     this->controller_->Show();
+    this->record_show_time_(micros() - start);
   }
 
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
@@ -103,6 +109,28 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   }
 
  protected:
+  void write_range_internal(int32_t start, const light::ESPColor *colors, int32_t count, bool write_white) override {
+    uint8_t *base = this->controller_->Pixels() + T_COLOR_FEATURE::PixelSize * start;
+    this->correction_.color_correct_range(colors, count, base, T_COLOR_FEATURE::PixelSize, this->rgb_offsets_,
+                                          write_white ? T_COLOR_FEATURE::PixelSize : 3);
+  }
+  void fill_internal(int32_t start, int32_t count, const light::ESPColor &color) override {
+    // correct the first LED and copy it to the others
+    this->write_range_internal(start, &color, 1, true);
+    uint8_t *base = this->controller_->Pixels() + T_COLOR_FEATURE::PixelSize * start;
+    for (int32_t i = 1; i < count; i++)
+      memcpy(base + T_COLOR_FEATURE::PixelSize * i, base, T_COLOR_FEATURE::PixelSize);
+  }
+  void move_internal(int32_t dst, int32_t src, int32_t count) override {
+    uint8_t *pixels = this->controller_->Pixels();
+    memmove(pixels + T_COLOR_FEATURE::PixelSize * dst, pixels + T_COLOR_FEATURE::PixelSize * src,
+            T_COLOR_FEATURE::PixelSize * count);
+  }
+  void rotate_internal(int32_t amnt) override {
+    uint8_t *pixels = this->controller_->Pixels();
+    std::rotate(pixels, pixels + T_COLOR_FEATURE::PixelSize * amnt, pixels + T_COLOR_FEATURE::PixelSize * this->size());
+  }
+
   NeoPixelBus<T_COLOR_FEATURE, T_METHOD> *controller_{nullptr};
   uint8_t *effect_data_{nullptr};
   uint8_t rgb_offsets_[4]{0, 1, 2, 3};
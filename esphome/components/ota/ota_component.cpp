@@ -16,6 +16,10 @@ namespace esphome {
 namespace ota {
 
 static const char *TAG = "ota";
+#ifdef USE_TICKLESS_LOOP
+/// How often to check for OTA connections once loop() is disabled.
+static const uint32_t OTA_IDLE_POLL_INTERVAL = 250;
+#endif
 
 uint8_t OTA_VERSION_1_0 = 1;
 
@@ -46,6 +50,14 @@ void OTAComponent::loop() {
     ESP_LOGI(TAG, "Boot seems successful, resetting boot loop counter.");
     this->clean_rtc();
   }
+
+#ifdef USE_TICKLESS_LOOP
+  if (!this->has_safe_mode_) {
+    // WiFiServer can only be polled, do that less often from the scheduler so that the main loop can sleep
+    this->disable_loop();
+    this->set_interval("handle", OTA_IDLE_POLL_INTERVAL, [this]() { this->handle_(); });
+  }
+#endif
 }
 
 void OTAComponent::handle_() {
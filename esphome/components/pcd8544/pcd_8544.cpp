@@ -29,6 +29,7 @@ void PCD8544::init_reset_() {
 
 void PCD8544::initialize() {
   this->init_internal_(this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_PAGES, 1);
 
   this->command(this->PCD8544_FUNCTIONSET | this->PCD8544_EXTENDEDINSTRUCTION);
   // LCD bias select (4 is optimal?)
@@ -63,22 +64,16 @@ size_t PCD8544::get_buffer_length_() {
 }
 
 void HOT PCD8544::display() {
-  uint8_t col, maxcol, p;
-
-  for (p = 0; p < 6; p++) {
-    this->command(this->PCD8544_SETYADDR | p);
-
-    // start at the beginning of the row
-    col = 0;
-    maxcol = this->get_width_internal() - 1;
-
-    this->command(this->PCD8544_SETXADDR | col);
-
-    this->start_data_();
-    for (; col <= maxcol; col++) {
-      this->write_byte(this->buffer_[(this->get_width_internal() * p) + col]);
+  for (auto &region : this->get_flush_regions_()) {
+    for (uint8_t p = region.y1 / 8; p <= region.y2 / 8; p++) {
+      this->command(this->PCD8544_SETYADDR | p);
+      // start at the first changed column of the row
+      this->command(this->PCD8544_SETXADDR | region.x1);
+
+      this->start_data_();
+      this->write_array(this->buffer_ + this->get_width_internal() * p + region.x1, region.width());
+      this->end_data_();
     }
-    this->end_data_();
   }
 
   this->command(this->PCD8544_SETYADDR);
@@ -120,6 +115,7 @@ void PCD8544::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_all_dirty_();
 }
 
 }  // namespace pcd8544
@@ -0,0 +1,28 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+from esphome.core import coroutine_with_priority
+
+preferences_ns = cg.esphome_ns.namespace('preferences')
+IntervalSyncer = preferences_ns.class_('IntervalSyncer', cg.Component)
+
+CONF_FLASH_WRITE_INTERVAL = 'flash_write_interval'
+CONF_ESP8266_FLASH_SECTORS = 'esp8266_flash_sectors'
+
+CONFIG_SCHEMA = cv.Schema({
+    cv.GenerateID(): cv.declare_id(IntervalSyncer),
+    cv.Optional(CONF_FLASH_WRITE_INTERVAL, default='60s'): cv.positive_time_period_milliseconds,
+    cv.Optional(CONF_ESP8266_FLASH_SECTORS): cv.All(cv.only_on_esp8266, cv.int_range(min=1, max=16)),
+}).extend(cv.COMPONENT_SCHEMA)
+
+
+# Before App.pre_setup(), which loads the preferences
+@coroutine_with_priority(150.0)
+def to_code(config):
+    global_preferences = cg.esphome_ns.global_preferences
+    cg.add(global_preferences.set_flash_write_interval(config[CONF_FLASH_WRITE_INTERVAL]))
+    if CONF_ESP8266_FLASH_SECTORS in config:
+        cg.add(global_preferences.set_flash_sectors(config[CONF_ESP8266_FLASH_SECTORS]))
+
+    var = cg.new_Pvariable(config[CONF_ID])
+    yield cg.register_component(var, config)
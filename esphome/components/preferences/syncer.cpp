@@ -0,0 +1,36 @@
+#include "syncer.h"
+#include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
+
+namespace esphome {
+namespace preferences {
+
+static const char *TAG = "preferences";
+
+void IntervalSyncer::setup() {
+  const uint32_t interval = global_preferences.get_flash_write_interval();
+  if (interval != 0)
+    this->set_interval("sync", interval, [this]() { this->sync_(); });
+}
+void IntervalSyncer::sync_() {
+  if (!global_preferences.sync()) {
+    ESP_LOGW(TAG, "Writing preferences to flash failed!");
+    return;
+  }
+  const auto &stats = global_preferences.get_write_stats();
+  ESP_LOGV(TAG, "Preferences synced: %u syncs, %u writes, %u bytes, %u erases in total", stats.syncs, stats.writes,
+           stats.bytes_written, stats.erases);
+}
+void IntervalSyncer::dump_config() {
+  ESP_LOGCONFIG(TAG, "Preferences:");
+  ESP_LOGCONFIG(TAG, "  Flash Write Interval: %u ms", global_preferences.get_flash_write_interval());
+#ifdef ARDUINO_ARCH_ESP8266
+  ESP_LOGCONFIG(TAG, "  Flash Sectors: %u", global_preferences.get_flash_sectors());
+#endif
+  const auto &stats = global_preferences.get_write_stats();
+  ESP_LOGCONFIG(TAG, "  Writes: %u (%u bytes), Erases: %u", stats.writes, stats.bytes_written, stats.erases);
+}
+float IntervalSyncer::get_setup_priority() const { return setup_priority::DATA; }
+
+}  // namespace preferences
+}  // namespace esphome
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace preferences {
+
+/// Periodically writes the preferences changed since the last sync to flash.
+class IntervalSyncer : public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+
+ protected:
+  void sync_();
+};
+
+}  // namespace preferences
+}  // namespace esphome
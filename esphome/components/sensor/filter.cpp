@@ -1,6 +1,7 @@
 #include "filter.h"
 #include "sensor.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 
 namespace esphome {
 namespace sensor {
@@ -15,6 +16,27 @@ void Filter::input(float value) {
   if (out.has_value())
     this->output(*out);
 }
+size_t Filter::new_values(float *values, size_t count) {
+  size_t out = 0;
+  for (size_t i = 0; i < count; i++) {
+    optional<float> value = this->new_value(values[i]);
+    if (value.has_value())
+      values[out++] = *value;
+  }
+  return out;
+}
+void Filter::input_values(float *values, size_t count) {
+  ESP_LOGVV(TAG, "Filter(%p)::input_values(%u values)", this, count);
+  const size_t out = this->new_values(values, count);
+  if (out == 0)
+    return;
+  if (this->next_ == nullptr) {
+    for (size_t i = 0; i < out; i++)
+      this->parent_->internal_send_state_to_frontend(values[i]);
+  } else {
+    this->next_->input_values(values, out);
+  }
+}
 void Filter::output(float value) {
   if (this->next_ == nullptr) {
     ESP_LOGVV(TAG, "Filter(%p)::output(%f) -> SENSOR", this, value);
@@ -39,58 +61,82 @@ uint32_t Filter::calculate_remaining_interval(uint32_t input) {
   }
 }
 
-// MedianFilter
-MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
-void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
-optional<float> MedianFilter::new_value(float value) {
+// QuantileFilter
+QuantileFilter::QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile)
+    : window_(window_size, quantile), send_every_(send_every), send_at_(send_every - send_first_at) {}
+void QuantileFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
+void QuantileFilter::set_window_size(size_t window_size) { this->window_.set_window_size(window_size); }
+optional<float> QuantileFilter::new_value(float value) {
   if (!isnan(value)) {
-    while (this->queue_.size() >= this->window_size_) {
-      this->queue_.pop_front();
-    }
-    this->queue_.push_back(value);
-    ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
+    this->window_.push(value);
+    ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f)", this, value);
   }
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float median = 0.0f;
-    if (!this->queue_.empty()) {
-      std::deque<float> median_queue = this->queue_;
-      sort(median_queue.begin(), median_queue.end());
+    float result = 0.0f;
+    if (!this->window_.empty())
+      result = this->compute_value_();
 
-      size_t queue_size = median_queue.size();
-      if (queue_size % 2) {
-        median = median_queue[queue_size / 2];
-      } else {
-        median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-      }
-    }
-
-    ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f) SENDING", this, median);
-    return median;
+    ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING", this, result);
+    return result;
   }
   return {};
 }
 
-uint32_t MedianFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
+uint32_t QuantileFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
+
+// MedianFilter
+MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
+    : QuantileFilter(window_size, send_every, send_first_at, 0.5f) {}
+float MedianFilter::compute_value_() {
+  // With an even number of values, the lower heap ends with the lower of the two middle values
+  if (this->window_.size() % 2 == 0)
+    return (this->window_.get_lower() + this->window_.get_upper()) / 2.0f;
+  return this->window_.get_lower();
+}
+
+// MinFilter
+MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at)
+    : QuantileFilter(window_size, send_every, send_first_at, 0.0f) {}
+
+// MaxFilter
+MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
+    : QuantileFilter(window_size, send_every, send_first_at, 1.0f) {}
 
 // SlidingWindowMovingAverageFilter
+/// Add value to sum with Kahan summation, keeping the lost low-order bits in compensation.
+static void kahan_add(float &sum, float &compensation, float value) {
+  const float y = value - compensation;
+  const float t = sum + y;
+  compensation = (t - sum) - y;
+  sum = t;
+}
 SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every,
                                                                    size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : queue_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
 void SlidingWindowMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void SlidingWindowMovingAverageFilter::set_window_size(size_t window_size) {
+  this->queue_.set_capacity(window_size);
+  this->resum_();
+}
+void SlidingWindowMovingAverageFilter::resum_() {
+  this->sum_ = 0.0f;
+  this->compensation_ = 0.0f;
+  for (size_t i = 0; i < this->queue_.size(); i++)
+    kahan_add(this->sum_, this->compensation_, this->queue_[i]);
+  this->since_resum_ = 0;
+}
 optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
   if (!isnan(value)) {
-    if (this->queue_.size() == this->window_size_) {
-      this->sum_ -= this->queue_.front();
-      this->queue_.pop();
-    }
+    if (this->queue_.full())
+      kahan_add(this->sum_, this->compensation_, -this->queue_.pop());
     this->queue_.push(value);
-    this->sum_ += value;
+    kahan_add(this->sum_, this->compensation_, value);
+    // What Kahan summation can't compensate still adds up over weeks, so start over from the values once per window
+    if (++this->since_resum_ >= this->queue_.capacity())
+      this->resum_();
   }
   float average;
   if (this->queue_.empty())
@@ -131,6 +177,31 @@ optional<float> ExponentialMovingAverageFilter::new_value(float value) {
   }
   return {};
 }
+size_t ExponentialMovingAverageFilter::new_values(float *values, size_t count) {
+  const float alpha = this->alpha_;
+  float accumulator = this->accumulator_;
+  bool first_value = this->first_value_;
+  size_t send_at = this->send_at_;
+  size_t out = 0;
+  for (size_t i = 0; i < count; i++) {
+    const float value = values[i];
+    if (!isnan(value)) {
+      if (first_value)
+        accumulator = value;
+      else
+        accumulator = (alpha * value) + (1.0f - alpha) * accumulator;
+      first_value = false;
+    }
+    if (++send_at >= this->send_every_) {
+      send_at = 0;
+      values[out++] = accumulator;
+    }
+  }
+  this->accumulator_ = accumulator;
+  this->first_value_ = first_value;
+  this->send_at_ = send_at;
+  return out;
+}
 void ExponentialMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void ExponentialMovingAverageFilter::set_alpha(float alpha) { this->alpha_ = alpha; }
 uint32_t ExponentialMovingAverageFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
@@ -150,11 +221,23 @@ optional<float> LambdaFilter::new_value(float value) {
 OffsetFilter::OffsetFilter(float offset) : offset_(offset) {}
 
 optional<float> OffsetFilter::new_value(float value) { return value + this->offset_; }
+size_t OffsetFilter::new_values(float *values, size_t count) {
+  const float offset = this->offset_;
+  for (size_t i = 0; i < count; i++)
+    values[i] += offset;
+  return count;
+}
 
 // MultiplyFilter
 MultiplyFilter::MultiplyFilter(float multiplier) : multiplier_(multiplier) {}
 
 optional<float> MultiplyFilter::new_value(float value) { return value * this->multiplier_; }
+size_t MultiplyFilter::new_values(float *values, size_t count) {
+  const float multiplier = this->multiplier_;
+  for (size_t i = 0; i < count; i++)
+    values[i] *= multiplier;
+  return count;
+}
 
 // FilterOutValueFilter
 FilterOutValueFilter::FilterOutValueFilter(float value_to_filter_out) : value_to_filter_out_(value_to_filter_out) {}
@@ -176,6 +259,23 @@ optional<float> FilterOutValueFilter::new_value(float value) {
       return value;
   }
 }
+size_t FilterOutValueFilter::new_values(float *values, size_t count) {
+  size_t out = 0;
+  if (isnan(this->value_to_filter_out_)) {
+    for (size_t i = 0; i < count; i++) {
+      if (!isnan(values[i]))
+        values[out++] = values[i];
+    }
+  } else {
+    float accuracy_mult = pow10f(this->parent_->get_accuracy_decimals());
+    float rounded_filter_out = roundf(accuracy_mult * this->value_to_filter_out_);
+    for (size_t i = 0; i < count; i++) {
+      if (roundf(accuracy_mult * values[i]) != rounded_filter_out)
+        values[out++] = values[i];
+    }
+  }
+  return out;
+}
 
 // ThrottleFilter
 ThrottleFilter::ThrottleFilter(uint32_t min_time_between_inputs)
@@ -268,6 +368,13 @@ void HeartbeatFilter::setup() {
 float HeartbeatFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 optional<float> CalibrateLinearFilter::new_value(float value) { return value * this->slope_ + this->bias_; }
+size_t CalibrateLinearFilter::new_values(float *values, size_t count) {
+  const float slope = this->slope_;
+  const float bias = this->bias_;
+  for (size_t i = 0; i < count; i++)
+    values[i] = values[i] * slope + bias;
+  return count;
+}
 CalibrateLinearFilter::CalibrateLinearFilter(float slope, float bias) : slope_(slope), bias_(bias) {}
 
 optional<float> CalibratePolynomialFilter::new_value(float value) {
@@ -279,6 +386,29 @@ optional<float> CalibratePolynomialFilter::new_value(float value) {
   }
   return res;
 }
+size_t CalibratePolynomialFilter::new_values(float *values, size_t count) {
+  // Same operations per value as new_value(), but with the loops swapped so that each coefficient is applied to the
+  // whole block at once.
+  float res[FILTER_BLOCK_SIZE];
+  float x[FILTER_BLOCK_SIZE];
+  for (size_t start = 0; start < count; start += FILTER_BLOCK_SIZE) {
+    float *block = values + start;
+    const size_t n = std::min(count - start, FILTER_BLOCK_SIZE);
+    for (size_t i = 0; i < n; i++) {
+      res[i] = 0.0f;
+      x[i] = 1.0f;
+    }
+    for (float coefficient : this->coefficients_) {
+      for (size_t i = 0; i < n; i++) {
+        res[i] += x[i] * coefficient;
+        x[i] *= block[i];
+      }
+    }
+    for (size_t i = 0; i < n; i++)
+      block[i] = res[i];
+  }
+  return count;
+}
 
 }  // namespace sensor
 }  // namespace esphome
@@ -1,14 +1,17 @@
 #pragma once
 
-#include <queue>
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "rolling_quantile.h"
 
 namespace esphome {
 namespace sensor {
 
 class Sensor;
 
+/// The number of values Sensor::publish_states() passes through the filter chain at once.
+static const size_t FILTER_BLOCK_SIZE = 32;
+
 /** Apply a filter to sensor values such as moving average.
  *
  * This class is purposefully kept quite simple, since more complicated
@@ -27,10 +30,24 @@ class Filter {
    */
   virtual optional<float> new_value(float value) = 0;
 
+  /** Filter a block of values in place.
+   *
+   * This must behave like calling new_value() for each value in order, with the values that should be pushed out
+   * written to the start of the array. The default implementation does exactly that, filters that are cheap per
+   * value override it with a loop that doesn't need a virtual call and an optional for every value.
+   *
+   * @param values The new values, overwritten with the values that should be pushed out.
+   * @param count The number of new values.
+   * @return The number of values that should be pushed out.
+   */
+  virtual size_t new_values(float *values, size_t count);
+
   /// Initialize this filter, please note this can be called more than once.
   virtual void initialize(Sensor *parent, Filter *next);
 
   void input(float value);
+  /// Filter a block of values and pass the result down the chain, like input() for each value. Modifies values.
+  void input_values(float *values, size_t count);
 
   /// Return the amount of time that this filter is expected to take based on the input time interval.
   virtual uint32_t expected_interval(uint32_t input);
@@ -46,21 +63,23 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
-/** Simple median filter.
+/** Base class of the filters that push out a quantile of the last <window_size> values every <send_every> values.
  *
- * Takes the median of the last <send_every> values and pushes it out every <send_every>.
+ * The quantile is kept up to date with a RollingQuantile, so each value takes O(log window_size) time and no memory
+ * is allocated after construction.
  */
-class MedianFilter : public Filter {
+class QuantileFilter : public Filter {
  public:
-  /** Construct a MedianFilter.
+  /** Construct a QuantileFilter.
    *
-   * @param window_size The number of values that should be used in median calculation.
+   * @param window_size The number of values that should be used in quantile calculation.
    * @param send_every After how many sensor values should a new one be pushed out.
    * @param send_first_at After how many values to forward the very first value. Defaults to the first value
    *   on startup being published on the first *raw* value, so with no filter applied. Must be less than or equal to
    *   send_every.
+   * @param quantile The quantile between 0 and 1, see RollingQuantile.
    */
-  explicit MedianFilter(size_t window_size, size_t send_every, size_t send_first_at);
+  explicit QuantileFilter(size_t window_size, size_t send_every, size_t send_first_at, float quantile);
 
   optional<float> new_value(float value) override;
 
@@ -70,10 +89,44 @@ class MedianFilter : public Filter {
   uint32_t expected_interval(uint32_t input) override;
 
  protected:
-  std::deque<float> queue_;
+  /// The value to push out, the window is not empty.
+  virtual float compute_value_() { return this->window_.get_lower(); }
+
+  RollingQuantile window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
+};
+
+/** Simple median filter.
+ *
+ * Takes the median of the last <window_size> values and pushes it out every <send_every>.
+ */
+class MedianFilter : public QuantileFilter {
+ public:
+  /** Construct a MedianFilter.
+   *
+   * @param window_size The number of values that should be used in median calculation.
+   * @param send_every After how many sensor values should a new one be pushed out.
+   * @param send_first_at After how many values to forward the very first value. Defaults to the first value
+   *   on startup being published on the first *raw* value, so with no filter applied. Must be less than or equal to
+   *   send_every.
+   */
+  explicit MedianFilter(size_t window_size, size_t send_every, size_t send_first_at);
+
+ protected:
+  float compute_value_() override;
+};
+
+/// Pushes out the minimum of the last <window_size> values every <send_every>.
+class MinFilter : public QuantileFilter {
+ public:
+  explicit MinFilter(size_t window_size, size_t send_every, size_t send_first_at);
+};
+
+/// Pushes out the maximum of the last <window_size> values every <send_every>.
+class MaxFilter : public QuantileFilter {
+ public:
+  explicit MaxFilter(size_t window_size, size_t send_every, size_t send_first_at);
 };
 
 /** Simple sliding window moving average filter.
@@ -101,11 +154,18 @@ class SlidingWindowMovingAverageFilter : public Filter {
   uint32_t expected_interval(uint32_t input) override;
 
  protected:
-  float sum_{0.0};
-  std::queue<float> queue_;
+  /// Recalculate the sum from the values in the window, which removes the rounding error that builds up over time.
+  void resum_();
+
+  FixedRingBuffer<float> queue_;
+  /// Sum of the window, updated with Kahan summation.
+  float sum_{0.0f};
+  /// Kahan compensation, the low-order bits lost from sum_.
+  float compensation_{0.0f};
+  /// Values since the sum was last recalculated.
+  size_t since_resum_{0};
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple exponential moving average filter.
@@ -118,6 +178,7 @@ class ExponentialMovingAverageFilter : public Filter {
   ExponentialMovingAverageFilter(float alpha, size_t send_every);
 
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
   void set_send_every(size_t send_every);
   void set_alpha(float alpha);
@@ -160,6 +221,7 @@ class OffsetFilter : public Filter {
   explicit OffsetFilter(float offset);
 
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   float offset_;
@@ -171,6 +233,7 @@ class MultiplyFilter : public Filter {
   explicit MultiplyFilter(float multiplier);
 
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   float multiplier_;
@@ -182,6 +245,7 @@ class FilterOutValueFilter : public Filter {
   explicit FilterOutValueFilter(float value_to_filter_out);
 
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   float value_to_filter_out_;
@@ -267,6 +331,7 @@ class CalibrateLinearFilter : public Filter {
  public:
   CalibrateLinearFilter(float slope, float bias);
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   float slope_;
@@ -277,6 +342,7 @@ class CalibratePolynomialFilter : public Filter {
  public:
   CalibratePolynomialFilter(const std::vector<float> &coefficients) : coefficients_(coefficients) {}
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   std::vector<float> coefficients_;
@@ -0,0 +1,158 @@
+#include "rolling_quantile.h"
+#include <cmath>
+
+namespace esphome {
+namespace sensor {
+
+RollingQuantile::RollingQuantile(size_t window_size, float quantile) : quantile_(quantile) {
+  this->set_window_size(window_size);
+}
+
+void RollingQuantile::set_window_size(size_t window_size) {
+  this->window_size_ = window_size;
+  this->values_.assign(window_size, 0.0f);
+  this->pos_.assign(window_size, 0);
+  this->lower_.assign(window_size, 0);
+  this->upper_.assign(window_size, 0);
+  this->clear();
+}
+
+void RollingQuantile::clear() {
+  this->size_ = 0;
+  this->next_ = 0;
+  this->lower_size_ = 0;
+  this->upper_size_ = 0;
+}
+
+size_t RollingQuantile::lower_count_(size_t n) const {
+  // Allow for the rounding error of the product, so that for example 0.3 of 10 values is 3 and not 4
+  const float rank = ceilf(n * this->quantile_ - 1e-4f);
+  if (rank < 1.0f)
+    return 1;
+  if (rank > n)
+    return n;
+  return static_cast<size_t>(rank);
+}
+
+void RollingQuantile::push(float value) {
+  const size_t slot = this->next_;
+  this->next_ = (this->next_ + 1) % this->window_size_;
+  this->values_[slot] = value;
+
+  if (this->size_ == this->window_size_) {
+    // The slot held the oldest value, which was just replaced. Only its heap has to be fixed up.
+    const int32_t pos = this->pos_[slot];
+    if (pos >= 0) {
+      this->sift_lower_(pos);
+    } else {
+      this->sift_upper_(-pos - 1);
+    }
+    this->exchange_tops_();
+    return;
+  }
+
+  this->size_++;
+  if (this->lower_size_ != 0 && value <= this->get_lower()) {
+    this->push_lower_(slot);
+  } else {
+    this->push_upper_(slot);
+  }
+  // The window grew by one, so at most one value has to move to the other heap
+  const size_t target = this->lower_count_(this->size_);
+  while (this->lower_size_ > target)
+    this->push_upper_(this->pop_lower_());
+  while (this->lower_size_ < target)
+    this->push_lower_(this->pop_upper_());
+}
+
+void RollingQuantile::sift_lower_(size_t index) {
+  // Max-heap
+  const size_t slot = this->lower_[index];
+  const float value = this->values_[slot];
+  while (index > 0) {
+    const size_t parent = (index - 1) / 2;
+    if (this->values_[this->lower_[parent]] >= value)
+      break;
+    this->set_lower_(index, this->lower_[parent]);
+    index = parent;
+  }
+  while (true) {
+    size_t child = 2 * index + 1;
+    if (child >= this->lower_size_)
+      break;
+    if (child + 1 < this->lower_size_ && this->values_[this->lower_[child + 1]] > this->values_[this->lower_[child]])
+      child++;
+    if (this->values_[this->lower_[child]] <= value)
+      break;
+    this->set_lower_(index, this->lower_[child]);
+    index = child;
+  }
+  this->set_lower_(index, slot);
+}
+
+void RollingQuantile::sift_upper_(size_t index) {
+  // Min-heap
+  const size_t slot = this->upper_[index];
+  const float value = this->values_[slot];
+  while (index > 0) {
+    const size_t parent = (index - 1) / 2;
+    if (this->values_[this->upper_[parent]] <= value)
+      break;
+    this->set_upper_(index, this->upper_[parent]);
+    index = parent;
+  }
+  while (true) {
+    size_t child = 2 * index + 1;
+    if (child >= this->upper_size_)
+      break;
+    if (child + 1 < this->upper_size_ && this->values_[this->upper_[child + 1]] < this->values_[this->upper_[child]])
+      child++;
+    if (this->values_[this->upper_[child]] >= value)
+      break;
+    this->set_upper_(index, this->upper_[child]);
+    index = child;
+  }
+  this->set_upper_(index, slot);
+}
+
+void RollingQuantile::push_lower_(size_t slot) {
+  this->set_lower_(this->lower_size_++, slot);
+  this->sift_lower_(this->lower_size_ - 1);
+}
+void RollingQuantile::push_upper_(size_t slot) {
+  this->set_upper_(this->upper_size_++, slot);
+  this->sift_upper_(this->upper_size_ - 1);
+}
+size_t RollingQuantile::pop_lower_() {
+  const size_t top = this->lower_[0];
+  if (--this->lower_size_ != 0) {
+    this->set_lower_(0, this->lower_[this->lower_size_]);
+    this->sift_lower_(0);
+  }
+  return top;
+}
+size_t RollingQuantile::pop_upper_() {
+  const size_t top = this->upper_[0];
+  if (--this->upper_size_ != 0) {
+    this->set_upper_(0, this->upper_[this->upper_size_]);
+    this->sift_upper_(0);
+  }
+  return top;
+}
+
+void RollingQuantile::exchange_tops_() {
+  if (this->lower_size_ == 0 || this->upper_size_ == 0)
+    return;
+  const size_t lower_top = this->lower_[0];
+  const size_t upper_top = this->upper_[0];
+  if (this->values_[lower_top] <= this->values_[upper_top])
+    return;
+  // Both heaps are otherwise still ordered against each other, so swapping the tops is enough
+  this->set_lower_(0, upper_top);
+  this->set_upper_(0, lower_top);
+  this->sift_lower_(0);
+  this->sift_upper_(0);
+}
+
+}  // namespace sensor
+}  // namespace esphome
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace sensor {
+
+/** A quantile of the last window_size values, updated in O(log window_size) per value.
+ *
+ * The values of the window are split into two heaps: a max-heap with the smallest values, up to and including the
+ * quantile, and a min-heap with the rest. The top of the lower heap is the quantile and the top of the upper heap
+ * the next larger value. Every heap entry refers to a slot of a ring buffer that holds the values in the order they
+ * were added, and every slot knows its position in the heaps, so the oldest value can be replaced in place when the
+ * window is full.
+ *
+ * All storage is allocated up front for the window size, adding values doesn't allocate.
+ */
+class RollingQuantile {
+ public:
+  /** Construct a RollingQuantile.
+   *
+   * @param window_size The number of values the quantile is taken of.
+   * @param quantile The quantile between 0 and 1. The value at rank ceil(quantile * n) (1-based, at least 1) of the
+   *   n sorted values is returned, so 0 is the minimum and 1 the maximum.
+   */
+  RollingQuantile(size_t window_size, float quantile);
+
+  /// Add a value, replacing the oldest one if the window is full. Must not be NaN.
+  void push(float value);
+  /// Remove all values.
+  void clear();
+  /// Resize the window, which removes all values.
+  void set_window_size(size_t window_size);
+
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  /// The quantile of the values in the window. Must not be empty.
+  float get_lower() const { return this->values_[this->lower_[0]]; }
+  /// Whether there's a value above the quantile, get_upper() is only valid then.
+  bool has_upper() const { return this->size_ > this->lower_size_; }
+  /// The smallest value above the quantile.
+  float get_upper() const { return this->values_[this->upper_[0]]; }
+
+ protected:
+  /// How many of n values belong to the lower heap.
+  size_t lower_count_(size_t n) const;
+
+  // The heaps store slot indices. pos_[slot] is the index in lower_ if >= 0, or -(index in upper_) - 1.
+  void set_lower_(size_t index, size_t slot) {
+    this->lower_[index] = slot;
+    this->pos_[slot] = static_cast<int32_t>(index);
+  }
+  void set_upper_(size_t index, size_t slot) {
+    this->upper_[index] = slot;
+    this->pos_[slot] = -static_cast<int32_t>(index) - 1;
+  }
+  void sift_lower_(size_t index);
+  void sift_upper_(size_t index);
+  void push_lower_(size_t slot);
+  void push_upper_(size_t slot);
+  size_t pop_lower_();
+  size_t pop_upper_();
+  /// Restore the order between the heaps after a value changed, by swapping the tops if necessary.
+  void exchange_tops_();
+
+  float quantile_;
+  size_t window_size_;
+  size_t size_{0};
+  /// The slot the next value is written to, the oldest value once the window is full.
+  size_t next_{0};
+  size_t lower_size_{0};
+  size_t upper_size_{0};
+  std::vector<float> values_;
+  std::vector<int32_t> pos_;
+  std::vector<size_t> lower_;
+  std::vector<size_t> upper_;
+};
+
+}  // namespace sensor
+}  // namespace esphome
@@ -1,5 +1,6 @@
 #include "sensor.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 
 namespace esphome {
 namespace sensor {
@@ -18,6 +19,26 @@ void Sensor::publish_state(float state) {
     this->filter_list_->input(state);
   }
 }
+void Sensor::publish_states(const float *states, size_t count) {
+  ESP_LOGV(TAG, "'%s': Received %u new states", this->name_.c_str(), count);
+
+  float block[FILTER_BLOCK_SIZE];
+  for (size_t start = 0; start < count; start += FILTER_BLOCK_SIZE) {
+    const size_t n = std::min(count - start, FILTER_BLOCK_SIZE);
+    for (size_t i = 0; i < n; i++) {
+      this->raw_state = states[start + i];
+      this->raw_callback_.call(this->raw_state);
+    }
+
+    if (this->filter_list_ == nullptr) {
+      for (size_t i = 0; i < n; i++)
+        this->internal_send_state_to_frontend(states[start + i]);
+    } else {
+      std::copy(states + start, states + start + n, block);
+      this->filter_list_->input_values(block, n);
+    }
+  }
+}
 void Sensor::push_new_value(float state) { this->publish_state(state); }
 std::string Sensor::unit_of_measurement() { return ""; }
 std::string Sensor::icon() { return ""; }
@@ -103,6 +103,18 @@ class Sensor : public Nameable {
    */
   void publish_state(float state);
 
+  /** Publish a block of new states at once, for sensors that take many samples in one go.
+   *
+   * Every state is assigned to raw_value and passed to the raw state callbacks, then the states go through the
+   * filters in blocks of FILTER_BLOCK_SIZE, so that each filter processes a block with a single call. The result is
+   * the same as calling publish_state() for each state, except that the raw state callbacks of a block are all
+   * called before its filtered states arrive.
+   *
+   * @param states The states, in the order they were measured.
+   * @param count The number of states.
+   */
+  void publish_states(const float *states, size_t count);
+
   /** Push a new value to the MQTT front-end.
    *
    * Note: deprecated, please use publish_state.
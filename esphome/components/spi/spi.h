@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/esphal.h"
 #include <SPI.h>
+#include <algorithm>
 
 namespace esphome {
 namespace spi {
@@ -61,6 +62,9 @@ enum SPIDataRate : uint32_t {
   DATA_RATE_40MHZ = 40000000,
 };
 
+/// The size of the chunks bulk writes are converted in, which matches the transmit FIFO of the ESP8266 and ESP32.
+static const size_t SPI_TRANSFER_CHUNK_SIZE = 64;
+
 class SPIComponent : public Component {
  public:
   void set_clk(GPIOPin *clk) { clk_ = clk; }
@@ -110,6 +114,30 @@ class SPIComponent : public Component {
     }
   }
 
+  /// Write an array of 16-bit words, each with the most significant byte first (the pixel format of most TFTs).
+  template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
+  void write_array16(const uint16_t *data, size_t length) {
+#ifdef ARDUINO_ARCH_ESP32
+    // writePixels() reads the buffer in 32-bit words, unaligned buffers take the byte path below
+    if (this->hw_spi_ != nullptr && (reinterpret_cast<uintptr_t>(data) & 3u) == 0) {
+      // swaps the bytes while filling the FIFO
+      this->hw_spi_->writePixels(data, length * 2);
+      return;
+    }
+#endif
+    uint8_t chunk[SPI_TRANSFER_CHUNK_SIZE];
+    while (length > 0) {
+      const size_t words = std::min(length, sizeof(chunk) / 2);
+      for (size_t i = 0; i < words; i++) {
+        chunk[i * 2] = data[i] >> 8;
+        chunk[i * 2 + 1] = data[i];
+      }
+      this->write_array<BIT_ORDER, CLOCK_POLARITY, CLOCK_PHASE>(chunk, words * 2);
+      data += words;
+      length -= words;
+    }
+  }
+
   template<SPIBitOrder BIT_ORDER, SPIClockPolarity CLOCK_POLARITY, SPIClockPhase CLOCK_PHASE>
   uint8_t transfer_byte(uint8_t data) {
     if (this->hw_spi_ != nullptr) {
@@ -216,6 +244,10 @@ class SPIDevice {
 
   void write_array(const std::vector<uint8_t> &data) { this->write_array(data.data(), data.size()); }
 
+  void write_array16(const uint16_t *data, size_t length) {
+    this->parent_->template write_array16<BIT_ORDER, CLOCK_POLARITY, CLOCK_PHASE>(data, length);
+  }
+
   uint8_t transfer_byte(uint8_t data) {
     return this->parent_->template transfer_byte<BIT_ORDER, CLOCK_POLARITY, CLOCK_PHASE>(data);
   }
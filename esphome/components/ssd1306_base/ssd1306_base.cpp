@@ -1,6 +1,7 @@
 #include "ssd1306_base.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
+#include <algorithm>
 
 namespace esphome {
 namespace ssd1306_base {
@@ -35,6 +36,7 @@ static const uint8_t SSD1306_NORMAL_DISPLAY = 0xA6;
 
 void SSD1306::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_PAGES, 1);
 
   this->command(SSD1306_COMMAND_DISPLAY_OFF);
   this->command(SSD1306_COMMAND_SET_DISPLAY_CLOCK_DIV);
@@ -95,30 +97,35 @@ void SSD1306::setup() {
   this->turn_on();
 }
 void SSD1306::display() {
-  if (this->is_sh1106_()) {
-    this->write_display_data();
-    return;
-  }
+  for (auto region : this->get_flush_regions_()) {
+    // the display is written in pages of 8 rows
+    region.y1 &= ~0x07;
+    region.y2 |= 0x07;
+    if (this->is_sh1106_()) {
+      this->write_display_data(region);
+      continue;
+    }
 
-  this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
-  switch (this->model_) {
-    case SSD1306_MODEL_64_48:
-      this->command(0x20);
-      this->command(0x20 + this->get_width_internal() - 1);
-      break;
-    default:
-      this->command(0);  // Page start address, 0
-      this->command(this->get_width_internal() - 1);
-      break;
-  }
+    this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
+    switch (this->model_) {
+      case SSD1306_MODEL_64_48:
+        this->command(0x20 + region.x1);
+        this->command(0x20 + region.x2);
+        break;
+      default:
+        this->command(region.x1);  // Column start address
+        this->command(region.x2);
+        break;
+    }
 
-  this->command(SSD1306_COMMAND_PAGE_ADDRESS);
-  // Page start address, 0
-  this->command(0);
-  // Page end address:
-  this->command((this->get_height_internal() / 8) - 1);
+    this->command(SSD1306_COMMAND_PAGE_ADDRESS);
+    // Page start address
+    this->command(region.y1 / 8);
+    // Page end address:
+    this->command(region.y2 / 8);
 
-  this->write_display_data();
+    this->write_display_data(region);
+  }
 }
 bool SSD1306::is_sh1106_() const {
   return this->model_ == SH1106_MODEL_96_16 || this->model_ == SH1106_MODEL_128_32 ||
@@ -194,10 +201,45 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, Color color) {
     this->buffer_[pos] &= ~(1 << subpos);
   }
 }
+void HOT SSD1306::fill_rect_internal(int x1, int y1, int width, int height, Color color) {
+  const int display_width = this->get_width_internal();
+  const bool on = color.is_on();
+  const int y2 = y1 + height - 1;
+  for (int page = y1 / 8; page <= y2 / 8; page++) {
+    // the bits of the rows of this page that are in the rectangle
+    const int first = std::max(y1 - page * 8, 0);
+    const int last = std::min(y2 - page * 8, 7);
+    const uint8_t mask = (0xFF << first) & (0xFF >> (7 - last));
+    uint8_t *column = this->buffer_ + page * display_width + x1;
+    if (mask == 0xFF) {
+      memset(column, on ? 0xFF : 0x00, width);
+    } else if (on) {
+      for (int x = 0; x < width; x++)
+        column[x] |= mask;
+    } else {
+      for (int x = 0; x < width; x++)
+        column[x] &= ~mask;
+    }
+  }
+}
+void HOT SSD1306::blit_bitmap_internal(int x1, int y1, const uint8_t *data, int width, int height, Color color) {
+  const int display_width = this->get_width_internal();
+  uint8_t *buffer = this->buffer_;
+  if (color.is_on()) {
+    display::for_each_bitmap_pixel(data, width, height, [buffer, display_width, x1, y1](int x, int y) {
+      buffer[x1 + x + ((y1 + y) / 8) * display_width] |= 1 << ((y1 + y) & 0x07);
+    });
+  } else {
+    display::for_each_bitmap_pixel(data, width, height, [buffer, display_width, x1, y1](int x, int y) {
+      buffer[x1 + x + ((y1 + y) / 8) * display_width] &= ~(1 << ((y1 + y) & 0x07));
+    });
+  }
+}
 void SSD1306::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_all_dirty_();
 }
 void SSD1306::init_reset_() {
   if (this->reset_pin_ != nullptr) {
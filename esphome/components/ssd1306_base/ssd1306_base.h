@@ -39,12 +39,18 @@ class SSD1306 : public PollingComponent, public display::DisplayBuffer {
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /** Write the pixels of region, which starts and ends at a page boundary.
+   *
+   * For the SSD1306 the display RAM window is already set to region, the SH1106 has to be addressed page by page.
+   */
+  virtual void write_display_data(const display::DisplayRegion &region) = 0;
   void init_reset_();
 
   bool is_sh1106_() const;
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_rect_internal(int x1, int y1, int width, int height, Color color) override;
+  void blit_bitmap_internal(int x1, int y1, const uint8_t *data, int width, int height, Color color) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
@@ -1,5 +1,6 @@
 #include "ssd1306_i2c.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 
 namespace esphome {
 namespace ssd1306_i2c {
@@ -32,27 +33,18 @@ void I2CSSD1306::dump_config() {
   }
 }
 void I2CSSD1306::command(uint8_t value) { this->write_byte(0x00, value); }
-void HOT I2CSSD1306::write_display_data() {
-  if (this->is_sh1106_()) {
-    uint32_t i = 0;
-    for (uint8_t page = 0; page < this->get_height_internal() / 8; page++) {
-      this->command(0xB0 + page);  // row
-      this->command(0x02);         // lower column
-      this->command(0x10);         // higher column
-
-      for (uint8_t x = 0; x < this->get_width_internal() / 16; x++) {
-        uint8_t data[16];
-        for (uint8_t &j : data)
-          j = this->buffer_[i++];
-        this->write_bytes(0x40, data, sizeof(data));
-      }
+void HOT I2CSSD1306::write_display_data(const display::DisplayRegion &region) {
+  const int width = this->get_width_internal();
+  const uint8_t column = region.x1 + 2;
+  for (uint8_t page = region.y1 / 8; page <= region.y2 / 8; page++) {
+    if (this->is_sh1106_()) {
+      this->command(0xB0 + page);           // row
+      this->command(column & 0x0F);         // lower column
+      this->command(0x10 | (column >> 4));  // higher column
     }
-  } else {
-    for (uint32_t i = 0; i < this->get_buffer_length_();) {
-      uint8_t data[16];
-      for (uint8_t &j : data)
-        j = this->buffer_[i++];
-      this->write_bytes(0x40, data, sizeof(data));
+    for (int x = region.x1; x <= region.x2; x += 16) {
+      const uint8_t len = std::min(region.x2 + 1 - x, 16);
+      this->write_bytes(0x40, this->buffer_ + page * width + x, len);
     }
   }
 }
@@ -30,24 +30,25 @@ void SPISSD1306::command(uint8_t value) {
   this->write_byte(value);
   this->disable();
 }
-void HOT SPISSD1306::write_display_data() {
+void HOT SPISSD1306::write_display_data(const display::DisplayRegion &region) {
+  const int width = this->get_width_internal();
   if (this->is_sh1106_()) {
-    for (uint8_t y = 0; y < this->get_height_internal() / 8; y++) {
+    const uint8_t column = region.x1 + 2;
+    for (uint8_t y = region.y1 / 8; y <= region.y2 / 8; y++) {
       this->command(0xB0 + y);
-      this->command(0x02);
-      this->command(0x10);
+      this->command(column & 0x0F);
+      this->command(0x10 | (column >> 4));
       this->dc_pin_->digital_write(true);
-      for (uint8_t x = 0; x < this->get_width_internal(); x++) {
-        this->enable();
-        this->write_byte(this->buffer_[x + y * this->get_width_internal()]);
-        this->disable();
-        App.feed_wdt();
-      }
+      this->enable();
+      this->write_array(this->buffer_ + y * width + region.x1, region.width());
+      this->disable();
+      App.feed_wdt();
     }
   } else {
     this->dc_pin_->digital_write(true);
     this->enable();
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int page = region.y1 / 8; page <= region.y2 / 8; page++)
+      this->write_array(this->buffer_ + page * width + region.x1, region.width());
     this->disable();
   }
 }
@@ -49,6 +49,7 @@ static const uint8_t SSD1322_SETCOMMANDLOCK_LOCK = 0x16;
 
 void SSD1322::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_ROWS, 4);
 
   this->command(SSD1322_SETCOMMANDLOCK);
   this->data(SSD1322_SETCOMMANDLOCK_UNLOCK);
@@ -123,7 +124,9 @@ void SSD1322::display() {
 }
 void SSD1322::update() {
   this->do_update_();
-  this->display();
+  // the display is only written as a whole, but can be skipped if nothing changed
+  if (!this->get_flush_regions_().empty())
+    this->display();
 }
 void SSD1322::set_brightness(float brightness) {
   this->brightness_ = clamp(brightness, 0, 1);
@@ -178,6 +181,7 @@ void SSD1322::fill(Color color) {
   uint8_t fill = (color4 & SSD1322_COLORMASK) | ((color4 & SSD1322_COLORMASK) << SSD1322_COLORSHIFT);
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_all_dirty_();
 }
 void SSD1322::init_reset_() {
   if (this->reset_pin_ != nullptr) {
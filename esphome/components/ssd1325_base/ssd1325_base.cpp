@@ -48,6 +48,7 @@ static const uint8_t SSD1325_COPY = 0x25;
 
 void SSD1325::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_ROWS, 4);
 
   this->command(SSD1325_DISPLAYOFF);    // display off
   this->command(SSD1325_SETCLOCK);      // set osc division
@@ -133,7 +134,9 @@ void SSD1325::display() {
 }
 void SSD1325::update() {
   this->do_update_();
-  this->display();
+  // the display is only written as a whole, but can be skipped if nothing changed
+  if (!this->get_flush_regions_().empty())
+    this->display();
 }
 void SSD1325::set_brightness(float brightness) {
   // validation
@@ -208,6 +211,7 @@ void SSD1325::fill(Color color) {
   uint8_t fill = (color4 & SSD1325_COLORMASK) | ((color4 & SSD1325_COLORMASK) << SSD1325_COLORSHIFT);
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_all_dirty_();
 }
 void SSD1325::init_reset_() {
   if (this->reset_pin_ != nullptr) {
@@ -43,6 +43,7 @@ static const uint8_t SSD1327_ACTIVATESCROLL = 0x2F;
 
 void SSD1327::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_ROWS, 4);
 
   this->turn_off();                             // display OFF
   this->command(SSD1327_SETFRONTCLOCKDIVIDER);  // set osc division
@@ -95,7 +96,9 @@ void SSD1327::display() {
 void SSD1327::update() {
   if (!this->is_failed()) {
     this->do_update_();
-    this->display();
+    // the display is only written as a whole, but can be skipped if nothing changed
+    if (!this->get_flush_regions_().empty())
+      this->display();
   }
 }
 void SSD1327::set_brightness(float brightness) {
@@ -152,6 +155,7 @@ void SSD1327::fill(Color color) {
   uint8_t fill = (color4 & SSD1327_COLORMASK) | ((color4 & SSD1327_COLORMASK) << SSD1327_COLORSHIFT);
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_all_dirty_();
 }
 void SSD1327::init_reset_() {
   if (this->reset_pin_ != nullptr) {
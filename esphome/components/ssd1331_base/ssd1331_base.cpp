@@ -46,6 +46,7 @@ static const uint8_t SSD1331_VCOMH = 0xBE;           // Set Vcomh voltge
 
 void SSD1331::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_ROWS, 16);
 
   this->command(SSD1331_DISPLAYOFF);  // 0xAE
   this->command(SSD1331_SETREMAP);    // 0xA0
@@ -83,13 +84,15 @@ void SSD1331::setup() {
   this->turn_on();    // display ON
 }
 void SSD1331::display() {
-  this->command(SSD1331_SETCOLUMN);  // set column address
-  this->command(0x00);               // set column start address
-  this->command(0x5F);               // set column end address
-  this->command(SSD1331_SETROW);     // set row address
-  this->command(0x00);               // set row start address
-  this->command(0x3F);               // set last row
-  this->write_display_data();
+  for (auto &region : this->get_flush_regions_()) {
+    this->command(SSD1331_SETCOLUMN);  // set column address
+    this->command(region.x1);          // set column start address
+    this->command(region.x2);          // set column end address
+    this->command(SSD1331_SETROW);     // set row address
+    this->command(region.y1);          // set row start address
+    this->command(region.y2);          // set last row
+    this->write_display_data(region);
+  }
 }
 void SSD1331::update() {
   this->do_update_();
@@ -129,6 +132,14 @@ void HOT SSD1331::draw_absolute_pixel_internal(int x, int y, Color color) {
   this->buffer_[pos++] = (color565 >> 8) & 0xff;
   this->buffer_[pos] = color565 & 0xff;
 }
+void HOT SSD1331::blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha) {
+  if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
+    return;
+  uint8_t *pixel = this->buffer_ + (x + y * this->get_width_internal()) * SSD1331_BYTESPERPIXEL;
+  const uint16_t color565 = display::blend_rgb565(color.to_rgb_565(), (pixel[0] << 8) | pixel[1], alpha);
+  pixel[0] = color565 >> 8;
+  pixel[1] = color565;
+}
 void SSD1331::fill(Color color) {
   const uint32_t color565 = color.to_rgb_565();
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
@@ -137,6 +148,7 @@ void SSD1331::fill(Color color) {
     } else {
       this->buffer_[i] = (color565 >> 8) & 0xff;
     }
+  this->mark_all_dirty_();
 }
 void SSD1331::init_reset_() {
   if (this->reset_pin_ != nullptr) {
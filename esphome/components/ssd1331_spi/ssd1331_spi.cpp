@@ -40,7 +40,7 @@ void SPISSD1331::command(uint8_t value) {
     this->cs_->digital_write(true);
   this->disable();
 }
-void HOT SPISSD1331::write_display_data() {
+void HOT SPISSD1331::write_display_data(const display::DisplayRegion &region) {
   if (this->cs_)
     this->cs_->digital_write(true);
   this->dc_pin_->digital_write(true);
@@ -48,7 +48,10 @@ void HOT SPISSD1331::write_display_data() {
     this->cs_->digital_write(false);
   delay(1);
   this->enable();
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  for (int y = region.y1; y <= region.y2; y++) {
+    const size_t pos = (size_t(y) * this->get_width_internal() + region.x1) * 2;
+    this->write_array(this->buffer_ + pos, region.width() * 2);
+  }
   if (this->cs_)
     this->cs_->digital_write(true);
   this->disable();
@@ -51,6 +51,7 @@ static const uint8_t SSD1351_STARTSCROLL = 0x9F;
 
 void SSD1351::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_ROWS, 16);
 
   this->command(SSD1351_COMMANDLOCK);
   this->data(0x12);
@@ -92,14 +93,16 @@ void SSD1351::setup() {
   this->turn_on();    // display ON
 }
 void SSD1351::display() {
-  this->command(SSD1351_SETCOLUMN);  // set column address
-  this->data(0x00);                  // set column start address
-  this->data(0x7F);                  // set column end address
-  this->command(SSD1351_SETROW);     // set row address
-  this->data(0x00);                  // set row start address
-  this->data(0x7F);                  // set last row
-  this->command(SSD1351_WRITERAM);
-  this->write_display_data();
+  for (auto &region : this->get_flush_regions_()) {
+    this->command(SSD1351_SETCOLUMN);  // set column address
+    this->data(region.x1);             // set column start address
+    this->data(region.x2);             // set column end address
+    this->command(SSD1351_SETROW);     // set row address
+    this->data(region.y1);             // set row start address
+    this->data(region.y2);             // set last row
+    this->command(SSD1351_WRITERAM);
+    this->write_display_data(region);
+  }
 }
 void SSD1351::update() {
   this->do_update_();
@@ -157,6 +160,14 @@ void HOT SSD1351::draw_absolute_pixel_internal(int x, int y, Color color) {
   this->buffer_[pos++] = (color565 >> 8) & 0xff;
   this->buffer_[pos] = color565 & 0xff;
 }
+void HOT SSD1351::blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha) {
+  if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
+    return;
+  uint8_t *pixel = this->buffer_ + (x + y * this->get_width_internal()) * SSD1351_BYTESPERPIXEL;
+  const uint16_t color565 = display::blend_rgb565(color.to_rgb_565(), (pixel[0] << 8) | pixel[1], alpha);
+  pixel[0] = color565 >> 8;
+  pixel[1] = color565;
+}
 void SSD1351::fill(Color color) {
   const uint32_t color565 = color.to_rgb_565();
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
@@ -165,6 +176,7 @@ void SSD1351::fill(Color color) {
     } else {
       this->buffer_[i] = (color565 >> 8) & 0xff;
     }
+  this->mark_all_dirty_();
 }
 void SSD1351::init_reset_() {
   if (this->reset_pin_ != nullptr) {
@@ -34,10 +34,12 @@ class SSD1351 : public PollingComponent, public display::DisplayBuffer {
  protected:
   virtual void command(uint8_t value) = 0;
   virtual void data(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Write the pixels of region, after the display RAM window has been set to it.
+  virtual void write_display_data(const display::DisplayRegion &region) = 0;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
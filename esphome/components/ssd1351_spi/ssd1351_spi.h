@@ -21,7 +21,7 @@ class SPISSD1351 : public ssd1351_base::SSD1351,
   void command(uint8_t value) override;
   void data(uint8_t value) override;
 
-  void write_display_data() override;
+  void write_display_data(const display::DisplayRegion &region) override;
 
   GPIOPin *dc_pin_;
 };
@@ -219,6 +219,8 @@ static const uint8_t PROGMEM
 
 // clang-format on
 static const char *TAG = "st7735";
+/// The number of pixels converted to RGB565 at once before they are written to the bus.
+static const size_t ST7735_TRANSFER_CHUNK_PIXELS = 128;
 
 ST7735::ST7735(ST7735Model model, int width, int height, int colstart, int rowstart, boolean eightbitcolor,
                boolean usebgr) {
@@ -285,6 +287,7 @@ void ST7735::setup() {
 
   this->init_internal_(this->get_buffer_length());
   memset(this->buffer_, 0x00, this->get_buffer_length());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_ROWS, this->eightbitcolor_ ? 8 : 16);
 }
 
 void ST7735::update() {
@@ -319,6 +322,61 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
   }
 }
 
+void HOT ST7735::blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha) {
+  if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
+    return;
+
+  if (this->eightbitcolor_) {
+    uint8_t &pixel = this->buffer_[x + y * this->get_width_internal()];
+    pixel = display::blend_rgb332(color.to_332(), pixel, alpha);
+  } else {
+    uint8_t *pixel = this->buffer_ + (x + y * this->get_width_internal()) * 2;
+    const uint16_t color565 = display::blend_rgb565(color.to_565(), (pixel[0] << 8) | pixel[1], alpha);
+    pixel[0] = color565 >> 8;
+    pixel[1] = color565;
+  }
+}
+
+void HOT ST7735::fill_rect_internal(int x1, int y1, int width, int height, Color color) {
+  const size_t bytes_per_pixel = this->eightbitcolor_ ? 1 : 2;
+  const size_t stride = this->get_width_internal() * bytes_per_pixel;
+  const size_t length = width * bytes_per_pixel;
+  uint8_t *first = this->buffer_ + y1 * stride + x1 * bytes_per_pixel;
+  if (this->eightbitcolor_) {
+    memset(first, color.to_332(), length);
+  } else {
+    const uint32_t color565 = color.to_565();
+    for (size_t i = 0; i < length; i += 2) {
+      first[i] = (color565 >> 8) & 0xff;
+      first[i + 1] = color565 & 0xff;
+    }
+  }
+  // the other rows are copies of the first one
+  for (int y = 1; y < height; y++)
+    memcpy(first + y * stride, first, length);
+}
+
+void HOT ST7735::blit_bitmap_internal(int x1, int y1, const uint8_t *data, int width, int height, Color color) {
+  const int stride = this->get_width_internal();
+  if (this->eightbitcolor_) {
+    const uint8_t color332 = color.to_332();
+    uint8_t *start = this->buffer_ + y1 * stride + x1;
+    display::for_each_bitmap_pixel(data, width, height, [start, stride, color332](int x, int y) {
+      start[y * stride + x] = color332;
+    });
+  } else {
+    const uint32_t color565 = color.to_565();
+    const uint8_t high = (color565 >> 8) & 0xff;
+    const uint8_t low = color565 & 0xff;
+    uint8_t *start = this->buffer_ + (y1 * stride + x1) * 2;
+    display::for_each_bitmap_pixel(data, width, height, [start, stride, high, low](int x, int y) {
+      uint8_t *pixel = start + (y * stride + x) * 2;
+      pixel[0] = high;
+      pixel[1] = low;
+    });
+  }
+}
+
 void ST7735::init_reset_() {
   if (this->reset_pin_ != nullptr) {
     this->reset_pin_->setup();
@@ -414,47 +472,56 @@ void HOT ST7735::senddata_(const uint8_t *data_bytes, uint8_t num_data_bytes) {
 }
 
 void HOT ST7735::write_display_data_() {
-  uint16_t offsetx = colstart_;
-  uint16_t offsety = rowstart_;
-
-  uint16_t x1 = offsetx;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = offsety;
-  uint16_t y2 = y1 + get_height_internal() - 1;
-
-  this->enable();
-
-  // set column(x) address
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST77XX_CASET);
-  this->dc_pin_->digital_write(true);
-  this->spi_master_write_addr_(x1, x2);
-
-  // set Page(y) address
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST77XX_RASET);
-  this->dc_pin_->digital_write(true);
-  this->spi_master_write_addr_(y1, y2);
-
-  //  Memory Write
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST77XX_RAMWR);
-  this->dc_pin_->digital_write(true);
-
-  if (this->eightbitcolor_) {
-    for (int line = 0; line < this->get_buffer_length(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
-        auto color = Color(this->buffer_[index + line], Color::ColorOrder::COLOR_ORDER_RGB,
-                           Color::ColorBitness::COLOR_BITNESS_332, true)
-                         .to_565();
-        this->write_byte((color >> 8) & 0xff);
-        this->write_byte(color & 0xff);
+  for (auto &region : this->get_flush_regions_()) {
+    uint16_t x1 = colstart_ + region.x1;
+    uint16_t x2 = colstart_ + region.x2;
+    uint16_t y1 = rowstart_ + region.y1;
+    uint16_t y2 = rowstart_ + region.y2;
+
+    this->enable();
+
+    // set column(x) address
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST77XX_CASET);
+    this->dc_pin_->digital_write(true);
+    this->spi_master_write_addr_(x1, x2);
+
+    // set Page(y) address
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST77XX_RASET);
+    this->dc_pin_->digital_write(true);
+    this->spi_master_write_addr_(y1, y2);
+
+    //  Memory Write
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST77XX_RAMWR);
+    this->dc_pin_->digital_write(true);
+
+    if (this->eightbitcolor_) {
+      // the region is one continuous stream of pixels, convert and send it in chunks
+      alignas(4) uint16_t chunk[ST7735_TRANSFER_CHUNK_PIXELS];
+      size_t pending = 0;
+      for (int y = region.y1; y <= region.y2; y++) {
+        const uint8_t *row = this->buffer_ + size_t(y) * this->get_width_internal();
+        for (int x = region.x1; x <= region.x2; x++) {
+          chunk[pending++] =
+              Color(row[x], Color::ColorOrder::COLOR_ORDER_RGB, Color::ColorBitness::COLOR_BITNESS_332, true).to_565();
+          if (pending == ST7735_TRANSFER_CHUNK_PIXELS) {
+            this->write_array16(chunk, pending);
+            pending = 0;
+          }
+        }
+      }
+      if (pending > 0)
+        this->write_array16(chunk, pending);
+    } else {
+      for (int y = region.y1; y <= region.y2; y++) {
+        const size_t line = size_t(y) * this->get_width_internal();
+        this->write_array(this->buffer_ + (line + region.x1) * 2, region.width() * 2);
       }
     }
-  } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
+    this->disable();
   }
-  this->disable();
 }
 
 void ST7735::spi_master_write_addr_(uint16_t addr1, uint16_t addr2) {
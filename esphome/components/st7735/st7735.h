@@ -65,6 +65,9 @@ class ST7735 : public PollingComponent,
   void display_init_(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha) override;
+  void fill_rect_internal(int x1, int y1, int width, int height, Color color) override;
+  void blit_bitmap_internal(int x1, int y1, const uint8_t *data, int width, int height, Color color) override;
   void spi_master_write_addr_(uint16_t addr1, uint16_t addr2);
   void spi_master_write_color_(uint16_t color, uint16_t size);
 
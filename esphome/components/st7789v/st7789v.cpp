@@ -113,6 +113,7 @@ void ST7789V::setup() {
 
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_ROWS, 16);
 }
 
 void ST7789V::dump_config() {
@@ -134,31 +135,36 @@ void ST7789V::update() {
 void ST7789V::loop() {}
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = 52;   // _offsetx
-  uint16_t x2 = 186;  // _offsetx
-  uint16_t y1 = 40;   // _offsety
-  uint16_t y2 = 279;  // _offsety
-
-  this->enable();
-
-  // set column(x) address
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST7789_CASET);
-  this->dc_pin_->digital_write(true);
-  this->write_addr_(x1, x2);
-  // set page(y) address
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST7789_RASET);
-  this->dc_pin_->digital_write(true);
-  this->write_addr_(y1, y2);
-  // write display memory
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST7789_RAMWR);
-  this->dc_pin_->digital_write(true);
-
-  this->write_array(this->buffer_, this->get_buffer_length_());
-
-  this->disable();
+  for (auto &region : this->get_flush_regions_()) {
+    uint16_t x1 = 52 + region.x1;  // _offsetx
+    uint16_t x2 = 52 + region.x2;  // _offsetx
+    uint16_t y1 = 40 + region.y1;  // _offsety
+    uint16_t y2 = 40 + region.y2;  // _offsety
+
+    this->enable();
+
+    // set column(x) address
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST7789_CASET);
+    this->dc_pin_->digital_write(true);
+    this->write_addr_(x1, x2);
+    // set page(y) address
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST7789_RASET);
+    this->dc_pin_->digital_write(true);
+    this->write_addr_(y1, y2);
+    // write display memory
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST7789_RAMWR);
+    this->dc_pin_->digital_write(true);
+
+    for (int y = region.y1; y <= region.y2; y++) {
+      const size_t pos = (size_t(y) * this->get_width_internal() + region.x1) * 2;
+      this->write_array(this->buffer_ + pos, region.width() * 2);
+    }
+
+    this->disable();
+  }
 }
 
 void ST7789V::init_reset_() {
@@ -270,5 +276,14 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   this->buffer_[pos] = color565 & 0xff;
 }
 
+void HOT ST7789V::blend_absolute_pixel_internal(int x, int y, Color color, uint8_t alpha) {
+  if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
+    return;
+  uint8_t *pixel = this->buffer_ + (x + y * this->get_width_internal()) * 2;
+  const uint16_t color565 = display::blend_rgb565(color.to_rgb_565(), (pixel[0] << 8) | pixel[1], alpha);
+  pixel[0] = color565 >> 8;
+  pixel[1] = color565;
+}
+
 }  // namespace st7789v
 }  // namespace esphome
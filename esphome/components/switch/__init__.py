@@ -66,6 +66,7 @@ def register_switch(var, config):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_switch(var))
     yield setup_switch_core_(var, config)
+    cg.add_object_id_hash(var, config[CONF_NAME])
 
 
 SWITCH_ACTION_SCHEMA = maybe_simple_id({
@@ -52,6 +52,7 @@ def register_text_sensor(var, config):
         var = cg.Pvariable(config[CONF_ID], var)
     cg.add(cg.App.register_text_sensor(var))
     yield setup_text_sensor_core_(var, config)
+    cg.add_object_id_hash(var, config[CONF_NAME])
 
 
 @coroutine_with_priority(100.0)
@@ -2,6 +2,7 @@
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
+#include <algorithm>
 
 namespace esphome {
 namespace waveshare_epaper {
@@ -72,6 +73,7 @@ static const uint8_t PARTIAL_UPDATE_LUT_TTGO[LUT_SIZE_TTGO] = {
 
 void WaveshareEPaper::setup_pins_() {
   this->init_internal_(this->get_buffer_length_());
+  this->set_buffer_layout_(display::DISPLAY_BUFFER_LAYOUT_ROWS, 1);
   this->dc_pin_->setup();  // OUTPUT
   this->dc_pin_->digital_write(false);
   if (this->reset_pin_ != nullptr) {
@@ -96,6 +98,33 @@ void WaveshareEPaper::data(uint8_t value) {
   this->write_byte(value);
   this->end_data_();
 }
+void WaveshareEPaper::write_repeated_(uint8_t value, size_t length) {
+  uint8_t chunk[spi::SPI_TRANSFER_CHUNK_SIZE];
+  memset(chunk, value, sizeof(chunk));
+  while (length > 0) {
+    const size_t size = std::min(length, sizeof(chunk));
+    this->write_array(chunk, size);
+    length -= size;
+  }
+}
+void HOT WaveshareEPaper::write_buffer_4bpp_() {
+  uint8_t chunk[spi::SPI_TRANSFER_CHUNK_SIZE];
+  size_t pending = 0;
+  for (size_t i = 0; i < this->get_buffer_length_(); i++) {
+    uint8_t pixels = this->buffer_[i];
+    for (uint8_t j = 0; j < 4; j++) {
+      chunk[pending++] = (pixels & 0x80 ? 0x30 : 0x00) | (pixels & 0x40 ? 0x03 : 0x00);
+      pixels <<= 2;
+    }
+    if (pending == sizeof(chunk)) {
+      this->write_array(chunk, pending);
+      pending = 0;
+      App.feed_wdt();
+    }
+  }
+  if (pending > 0)
+    this->write_array(chunk, pending);
+}
 bool WaveshareEPaper::wait_until_idle_() {
   if (this->busy_pin_ == nullptr) {
     return true;
@@ -113,13 +142,16 @@ bool WaveshareEPaper::wait_until_idle_() {
 }
 void WaveshareEPaper::update() {
   this->do_update_();
-  this->display();
+  // the display is only written as a whole, but can be skipped if nothing changed
+  if (!this->get_flush_regions_().empty())
+    this->display();
 }
 void WaveshareEPaper::fill(Color color) {
   // flip logic
   const uint8_t fill = color.is_on() ? 0x00 : 0xFF;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
+  this->mark_all_dirty_();
 }
 void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || y >= this->get_height_internal() || x < 0 || y < 0)
@@ -532,8 +564,7 @@ void HOT WaveshareEPaper2P9InB::display() {
   this->command(0x13);
   delay(2);
   this->start_data_();
-  for (int i = 0; i < this->get_buffer_length_(); i++)
-    this->write_byte(0x00);
+  this->write_repeated_(0x00, this->get_buffer_length_());
   this->end_data_();
   delay(2);
 
@@ -736,28 +767,7 @@ void HOT WaveshareEPaper5P8In::display() {
   this->command(0x10);
 
   this->start_data_();
-  for (size_t i = 0; i < this->get_buffer_length_(); i++) {
-    uint8_t temp1 = this->buffer_[i];
-    for (uint8_t j = 0; j < 8; j++) {
-      uint8_t temp2;
-      if (temp1 & 0x80)
-        temp2 = 0x03;
-      else
-        temp2 = 0x00;
-
-      temp2 <<= 4;
-      temp1 <<= 1;
-      j++;
-      if (temp1 & 0x80)
-        temp2 |= 0x03;
-      else
-        temp2 |= 0x00;
-      temp1 <<= 1;
-      this->write_byte(temp2);
-    }
-
-    App.feed_wdt();
-  }
+  this->write_buffer_4bpp_();
   this->end_data_();
 
   // COMMAND DISPLAY REFRESH
@@ -819,26 +829,7 @@ void HOT WaveshareEPaper7P5In::display() {
   // COMMAND DATA START TRANSMISSION 1
   this->command(0x10);
   this->start_data_();
-  for (size_t i = 0; i < this->get_buffer_length_(); i++) {
-    uint8_t temp1 = this->buffer_[i];
-    for (uint8_t j = 0; j < 8; j++) {
-      uint8_t temp2;
-      if (temp1 & 0x80)
-        temp2 = 0x03;
-      else
-        temp2 = 0x00;
-      temp2 <<= 4;
-      temp1 <<= 1;
-      j++;
-      if (temp1 & 0x80)
-        temp2 |= 0x03;
-      else
-        temp2 |= 0x00;
-      temp1 <<= 1;
-      this->write_byte(temp2);
-    }
-    App.feed_wdt();
-  }
+  this->write_buffer_4bpp_();
   this->end_data_();
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
@@ -53,6 +53,11 @@ class WaveshareEPaper : public PollingComponent,
 
   uint32_t get_buffer_length_();
 
+  /// Write length copies of value.
+  void write_repeated_(uint8_t value, size_t length);
+  /// Write the buffer with 4 bits per pixel (0x0 white, 0x3 black), as the 5.83in and 7.5in panels expect.
+  void write_buffer_4bpp_();
+
   void start_command_();
   void end_command_();
   void start_data_();
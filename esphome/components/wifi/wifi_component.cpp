@@ -98,11 +98,21 @@ void WiFiComponent::loop() {
       case WIFI_COMPONENT_STATE_STA_CONNECTED: {
         if (!this->is_connected()) {
           ESP_LOGW(TAG, "WiFi Connection lost... Reconnecting...");
+#if defined(USE_TICKLESS_LOOP) && defined(ARDUINO_ARCH_ESP32)
+          // An idle loop() only notices this with the disconnect event, start the AP and reboot timeouts from here
+          this->last_connected_ = now;
+#endif
           this->state_ = WIFI_COMPONENT_STATE_STA_CONNECTING;
           this->retry_connect();
         } else {
           this->status_clear_warning();
           this->last_connected_ = now;
+#if defined(USE_TICKLESS_LOOP) && defined(ARDUINO_ARCH_ESP32)
+          // Nothing to do until the disconnect event enables the loop again. On the ESP8266 mDNS needs loop().
+          this->disable_loop();
+          if (!this->is_connected())
+            this->enable_loop();
+#endif
         }
         break;
       }
@@ -461,6 +461,12 @@ void WiFiComponent::wifi_event_callback_(system_event_id_t event, system_event_i
   if (event == SYSTEM_EVENT_SCAN_DONE) {
     this->wifi_scan_done_callback_();
   }
+#ifdef USE_TICKLESS_LOOP
+  if (event == SYSTEM_EVENT_STA_DISCONNECTED || event == SYSTEM_EVENT_STA_LOST_IP) {
+    // loop() is disabled while connected
+    this->enable_loop();
+  }
+#endif
 }
 void WiFiComponent::wifi_pre_setup_() {
   auto f = std::bind(&WiFiComponent::wifi_event_callback_, this, std::placeholders::_1, std::placeholders::_2);
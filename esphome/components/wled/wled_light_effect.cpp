@@ -39,9 +39,8 @@ void WLEDLightEffect::stop() {
 }
 
 void WLEDLightEffect::blank_all_leds_(light::AddressableLight &it) {
-  for (int led = it.size(); led-- > 0;) {
-    it[led].set(light::ESPColor::BLACK);
-  }
+  it.fill(0, it.size(), light::ESPColor::BLACK);
+  it.schedule_show();
 }
 
 void WLEDLightEffect::apply(light::AddressableLight &it, const light::ESPColor &current_color) {
@@ -67,6 +66,8 @@ void WLEDLightEffect::apply(light::AddressableLight &it, const light::ESPColor &
       ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=0x%02X).", payload.size(), payload[0]);
       continue;
     }
+
+    it.schedule_show();
   }
 
   // FIXME: Use roll-over safe arithmetic
@@ -165,18 +166,13 @@ bool WLEDLightEffect::parse_drgb_frame_(light::AddressableLight &it, const uint8
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
+  auto count = std::min<int32_t>(size / 3, it.size());
 
-  for (uint16_t led = 0; led < count; ++led, payload += 3) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(light::ESPColor(r, g, b));
-    }
-  }
+  it.write_generated(0, count, [&payload](int32_t) {
+    const uint8_t *rgb = payload;
+    payload += 3;
+    return light::ESPColor(rgb[0], rgb[1], rgb[2]);
+  });
 
   return true;
 }
@@ -187,19 +183,13 @@ bool WLEDLightEffect::parse_drgbw_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 4;
-  auto max_leds = it.size();
+  auto count = std::min<int32_t>(size / 4, it.size());
 
-  for (uint16_t led = 0; led < count; ++led, payload += 4) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-    uint8_t w = payload[3];
-
-    if (led < max_leds) {
-      it[led].set(light::ESPColor(r, g, b, w));
-    }
-  }
+  it.write_generated(0, count, [&payload](int32_t) {
+    const uint8_t *rgbw = payload;
+    payload += 4;
+    return light::ESPColor(rgbw[0], rgbw[1], rgbw[2], rgbw[3]);
+  });
 
   return true;
 }
@@ -219,18 +209,12 @@ bool WLEDLightEffect::parse_dnrgb_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
-
-  for (; count > 0; count--, payload += 3, led++) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(light::ESPColor(r, g, b));
-    }
-  }
+  // write_range() skips the LEDs past the end of the strip
+  it.write_generated(led, size / 3, [&payload](int32_t) {
+    const uint8_t *rgb = payload;
+    payload += 3;
+    return light::ESPColor(rgb[0], rgb[1], rgb[2]);
+  });
 
   return true;
 }
@@ -23,6 +23,8 @@ class WLEDLightEffect : public light::AddressableLightEffect {
 
  protected:
   void blank_all_leds_(light::AddressableLight &it);
+  // show every received frame as soon as possible
+  bool schedules_show_() const override { return true; }
   bool parse_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_notifier_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_warls_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
@@ -208,6 +208,8 @@ CONF_FOR = 'for'
 CONF_FORCE_UPDATE = 'force_update'
 CONF_FORMALDEHYDE = 'formaldehyde'
 CONF_FORMAT = 'format'
+CONF_FRAME_DIFF = 'frame_diff'
+CONF_FRAME_RATE = 'frame_rate'
 CONF_FREQUENCY = 'frequency'
 CONF_FROM = 'from'
 CONF_FULL_UPDATE_EVERY = 'full_update_every'
@@ -414,6 +416,7 @@ CONF_PROTOCOL = 'protocol'
 CONF_PULL_MODE = 'pull_mode'
 CONF_PULSE_LENGTH = 'pulse_length'
 CONF_QOS = 'qos'
+CONF_QUANTILE = 'quantile'
 CONF_RANDOM = 'random'
 CONF_RANGE = 'range'
 CONF_RANGE_FROM = 'range_from'
@@ -451,6 +454,7 @@ CONF_RX_BUFFER_SIZE = 'rx_buffer_size'
 CONF_RX_ONLY = 'rx_only'
 CONF_RX_PIN = 'rx_pin'
 CONF_SAFE_MODE = 'safe_mode'
+CONF_SAMPLES = 'samples'
 CONF_SAMSUNG = 'samsung'
 CONF_SCAN = 'scan'
 CONF_SCL = 'scl'
@@ -519,6 +523,7 @@ CONF_TEXT_SENSORS = 'text_sensors'
 CONF_THEN = 'then'
 CONF_THRESHOLD = 'threshold'
 CONF_THROTTLE = 'throttle'
+CONF_TICKLESS = 'tickless'
 CONF_TILT = 'tilt'
 CONF_TILT_ACTION = 'tilt_action'
 CONF_TILT_LAMBDA = 'tilt_lambda'
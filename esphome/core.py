@@ -623,6 +623,10 @@ class EsphomeCore:
     def firmware_bin(self):
         return self.relative_pioenvs_path(self.name, 'firmware.bin')
 
+    @property
+    def firmware_elf(self):
+        return self.relative_pioenvs_path(self.name, 'firmware.elf')
+
     @property
     def is_esp8266(self):
         if self.esp_platform is None:
@@ -11,6 +11,11 @@ namespace esphome {
 
 static const char *TAG = "app";
 
+// Upper bound for a single tickless sleep, so that the watchdog and status LED keep being serviced
+static const uint32_t MAX_TICKLESS_SLEEP = 1000;
+// Minimum length of the window over which loop statistics are calculated
+static const uint32_t LOOP_STATS_WINDOW = 1000;
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -56,6 +61,10 @@ void Application::setup() {
     } while (!component->can_proceed());
   }
 
+#if defined(USE_TICKLESS_LOOP) && defined(ARDUINO_ARCH_ESP32)
+  this->loop_task_handle_ = xTaskGetCurrentTaskHandle();
+#endif
+
   ESP_LOGI(TAG, "setup() finished successfully!");
   this->schedule_dump_config();
   this->calculate_looping_components_();
@@ -68,7 +77,13 @@ void Application::loop() {
   const uint32_t start = millis();
 
   this->scheduler.call();
+  bool loop_active = false;
   for (Component *component : this->looping_components_) {
+    if (!component->is_loop_enabled()) {
+      new_app_state |= component->get_component_state();
+      continue;
+    }
+    loop_active = true;
     component->call();
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
@@ -96,9 +111,19 @@ void Application::loop() {
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+#ifdef USE_TICKLESS_LOOP
+    if (!loop_active) {
+      // No component has loop() work, sleep until the next scheduled item or until woken up.
+      // Items scheduled by components during this iteration are still pending in the scheduler.
+      this->scheduler.process_to_add();
+      delay_time = this->scheduler.next_schedule_in().value_or(MAX_TICKLESS_SLEEP);
+      delay_time = std::min(delay_time, MAX_TICKLESS_SLEEP);
+    }
+#endif
+    this->idle_(delay_time);
   }
   this->last_loop_ = now;
+  this->update_loop_stats_(now);
 
   if (this->dump_config_at_ >= 0 && this->dump_config_at_ < this->components_.size()) {
     if (this->dump_config_at_ == 0) {
@@ -110,6 +135,56 @@ void Application::loop() {
   }
 }
 
+void ICACHE_RAM_ATTR Application::wake_loop() {
+  this->wake_requested_ = true;
+#if defined(USE_TICKLESS_LOOP) && defined(ARDUINO_ARCH_ESP32)
+  if (this->loop_task_handle_ == nullptr)
+    return;
+  if (xPortInIsrContext()) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(this->loop_task_handle_, &higher_priority_task_woken);
+    if (higher_priority_task_woken)
+      portYIELD_FROM_ISR();
+  } else {
+    xTaskNotifyGive(this->loop_task_handle_);
+  }
+#endif
+}
+void Application::idle_(uint32_t sleep_time) {
+  const uint32_t start = millis();
+#ifdef USE_TICKLESS_LOOP
+  if (!this->wake_requested_) {
+#ifdef ARDUINO_ARCH_ESP32
+    // Returns early when wake_loop() notifies this task
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleep_time));
+#endif
+#ifdef ARDUINO_ARCH_ESP8266
+    // delay() can't be interrupted here, so sleep in slices and check for wake-up requests in between
+    uint32_t slept = 0;
+    while (!this->wake_requested_ && slept < sleep_time) {
+      delay(std::min(sleep_time - slept, this->loop_interval_));
+      slept = millis() - start;
+    }
+#endif
+  }
+  this->wake_requested_ = false;
+#else
+  delay(sleep_time);
+#endif
+  this->stats_idle_ += millis() - start;
+}
+void Application::update_loop_stats_(uint32_t now) {
+  this->stats_loops_++;
+  const uint32_t elapsed = now - this->stats_start_;
+  if (elapsed < LOOP_STATS_WINDOW)
+    return;
+  this->loops_per_second_ = this->stats_loops_ * 1000.0f / elapsed;
+  this->idle_fraction_ = std::min(1.0f, this->stats_idle_ / float(elapsed));
+  this->stats_start_ = now;
+  this->stats_loops_ = 0;
+  this->stats_idle_ = 0;
+}
+
 void ICACHE_RAM_ATTR HOT Application::feed_wdt() {
   static uint32_t LAST_FEED = 0;
   uint32_t now = millis();
@@ -132,6 +207,7 @@ void Application::reboot() {
   ESP_LOGI(TAG, "Forcing a reboot...");
   for (auto *comp : this->components_)
     comp->on_shutdown();
+  global_preferences.sync();
   ESP.restart();
   // restart() doesn't always end execution
   while (true) {
@@ -144,6 +220,7 @@ void Application::safe_reboot() {
     comp->on_safe_shutdown();
   for (auto *comp : this->components_)
     comp->on_shutdown();
+  global_preferences.sync();
   ESP.restart();
   // restart() doesn't always end execution
   while (true) {
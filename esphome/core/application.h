@@ -5,6 +5,7 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/preferences.h"
 #include "esphome/core/component.h"
+#include "esphome/core/entity_index.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/scheduler.h"
 
@@ -46,35 +47,57 @@ class Application {
 #ifdef USE_BINARY_SENSOR
   void register_binary_sensor(binary_sensor::BinarySensor *binary_sensor) {
     this->binary_sensors_.push_back(binary_sensor);
+    this->binary_sensor_index_.add(binary_sensor);
   }
 #endif
 
 #ifdef USE_SENSOR
-  void register_sensor(sensor::Sensor *sensor) { this->sensors_.push_back(sensor); }
+  void register_sensor(sensor::Sensor *sensor) {
+    this->sensors_.push_back(sensor);
+    this->sensor_index_.add(sensor);
+  }
 #endif
 
 #ifdef USE_SWITCH
-  void register_switch(switch_::Switch *a_switch) { this->switches_.push_back(a_switch); }
+  void register_switch(switch_::Switch *a_switch) {
+    this->switches_.push_back(a_switch);
+    this->switch_index_.add(a_switch);
+  }
 #endif
 
 #ifdef USE_TEXT_SENSOR
-  void register_text_sensor(text_sensor::TextSensor *sensor) { this->text_sensors_.push_back(sensor); }
+  void register_text_sensor(text_sensor::TextSensor *sensor) {
+    this->text_sensors_.push_back(sensor);
+    this->text_sensor_index_.add(sensor);
+  }
 #endif
 
 #ifdef USE_FAN
-  void register_fan(fan::FanState *state) { this->fans_.push_back(state); }
+  void register_fan(fan::FanState *state) {
+    this->fans_.push_back(state);
+    this->fan_index_.add(state);
+  }
 #endif
 
 #ifdef USE_COVER
-  void register_cover(cover::Cover *cover) { this->covers_.push_back(cover); }
+  void register_cover(cover::Cover *cover) {
+    this->covers_.push_back(cover);
+    this->cover_index_.add(cover);
+  }
 #endif
 
 #ifdef USE_CLIMATE
-  void register_climate(climate::Climate *climate) { this->climates_.push_back(climate); }
+  void register_climate(climate::Climate *climate) {
+    this->climates_.push_back(climate);
+    this->climate_index_.add(climate);
+  }
 #endif
 
 #ifdef USE_LIGHT
-  void register_light(light::LightState *light) { this->lights_.push_back(light); }
+  void register_light(light::LightState *light) {
+    this->lights_.push_back(light);
+    this->light_index_.add(light);
+  }
 #endif
 
   /// Register the component in this Application instance.
@@ -112,6 +135,19 @@ class Application {
 
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
+  /** Wake up the main loop if it is sleeping.
+   *
+   * With a tickless loop, loop() sleeps until the next scheduled item when no component has loop() work to do.
+   * Call this from ISRs or other tasks (for example network callbacks) when there is new work.
+   */
+  void wake_loop();
+
+  /// Get the number of loop() iterations per second, measured over the last (at least) one second.
+  float get_loops_per_second() const { return this->loops_per_second_; }
+
+  /// Get the fraction of time spent sleeping between loop() iterations, measured over the last (at least) one second.
+  float get_idle_fraction() const { return this->idle_fraction_; }
+
   void feed_wdt();
 
   void reboot();
@@ -125,80 +161,59 @@ class Application {
     for (auto *comp : this->components_) {
       comp->on_shutdown();
     }
+    global_preferences.sync();
   }
 
   uint32_t get_app_state() const { return this->app_state_; }
 
+  const std::vector<Component *> &get_components() { return this->components_; }
+
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->binary_sensor_index_.find(key, include_internal);
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->switch_index_.find(key, include_internal);
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->sensor_index_.find(key, include_internal);
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->text_sensor_index_.find(key, include_internal);
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::FanState *> &get_fans() { return this->fans_; }
   fan::FanState *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->fan_index_.find(key, include_internal);
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->cover_index_.find(key, include_internal);
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->light_index_.find(key, include_internal);
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->climate_index_.find(key, include_internal);
   }
 #endif
 
@@ -211,32 +226,44 @@ class Application {
 
   void calculate_looping_components_();
 
+  /// Sleep for up to sleep_time ms, returning early if wake_loop() is called in tickless mode.
+  void idle_(uint32_t sleep_time);
+  void update_loop_stats_(uint32_t now);
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  EntityIndex<binary_sensor::BinarySensor> binary_sensor_index_;
 #endif
 #ifdef USE_SWITCH
   std::vector<switch_::Switch *> switches_{};
+  EntityIndex<switch_::Switch> switch_index_;
 #endif
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> sensors_{};
+  EntityIndex<sensor::Sensor> sensor_index_;
 #endif
 #ifdef USE_TEXT_SENSOR
   std::vector<text_sensor::TextSensor *> text_sensors_{};
+  EntityIndex<text_sensor::TextSensor> text_sensor_index_;
 #endif
 #ifdef USE_FAN
   std::vector<fan::FanState *> fans_{};
+  EntityIndex<fan::FanState> fan_index_;
 #endif
 #ifdef USE_COVER
   std::vector<cover::Cover *> covers_{};
+  EntityIndex<cover::Cover> cover_index_;
 #endif
 #ifdef USE_CLIMATE
   std::vector<climate::Climate *> climates_{};
+  EntityIndex<climate::Climate> climate_index_;
 #endif
 #ifdef USE_LIGHT
   std::vector<light::LightState *> lights_{};
+  EntityIndex<light::LightState> light_index_;
 #endif
 
   std::string name_;
@@ -245,6 +272,15 @@ class Application {
   uint32_t loop_interval_{16};
   int dump_config_at_{-1};
   uint32_t app_state_{0};
+  volatile bool wake_requested_{false};
+#if defined(USE_TICKLESS_LOOP) && defined(ARDUINO_ARCH_ESP32)
+  TaskHandle_t loop_task_handle_{nullptr};
+#endif
+  uint32_t stats_start_{0};
+  uint32_t stats_loops_{0};
+  uint32_t stats_idle_{0};
+  float loops_per_second_{0.0f};
+  float idle_fraction_{0.0f};
 };
 
 /// Global storage of Application pointer - only one Application can exist.
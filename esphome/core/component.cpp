@@ -46,24 +46,43 @@ void Component::set_interval(const std::string &name, uint32_t interval, std::fu
   App.scheduler.set_interval(this, name, interval, std::move(f));
 }
 
+void Component::set_interval(const char *name, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_interval(this, name, interval, std::move(f));
+}
+
 bool Component::cancel_interval(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_interval(this, name);
 }
 
+bool Component::cancel_interval(const char *name) {  // NOLINT
+  return App.scheduler.cancel_interval(this, name);
+}
+
 void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
   return App.scheduler.set_timeout(this, name, timeout, std::move(f));
 }
 
+void Component::set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, name, timeout, std::move(f));
+}
+
 bool Component::cancel_timeout(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
 
+bool Component::cancel_timeout(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
+
 void Component::call_loop() { this->loop(); }
 
 void Component::call_setup() { this->setup(); }
 uint32_t Component::get_component_state() const { return this->component_state_; }
 void Component::call() {
   uint32_t state = this->component_state_ & COMPONENT_STATE_MASK;
+#ifdef USE_COMPONENT_PROFILER
+  const uint32_t start = micros();
+#endif
   switch (state) {
     case COMPONENT_STATE_CONSTRUCTION:
       // State Construction: Call setup and set state to setup
@@ -87,6 +106,14 @@ void Component::call() {
     default:
       break;
   }
+#ifdef USE_COMPONENT_PROFILER
+  const uint32_t duration = micros() - start;
+  if (state == COMPONENT_STATE_CONSTRUCTION) {
+    this->setup_stats_.record(duration);
+  } else if (state == COMPONENT_STATE_SETUP || state == COMPONENT_STATE_LOOP) {
+    this->loop_stats_.record(duration);
+  }
+#endif
 }
 void Component::mark_failed() {
   ESP_LOGE(TAG, "Component was marked as failed.");
@@ -100,9 +127,15 @@ void Component::defer(std::function<void()> &&f) {  // NOLINT
 bool Component::cancel_defer(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
+bool Component::cancel_defer(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
 void Component::defer(const std::string &name, std::function<void()> &&f) {  // NOLINT
   App.scheduler.set_timeout(this, name, 0, std::move(f));
 }
+void Component::defer(const char *name, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, name, 0, std::move(f));
+}
 void Component::set_timeout(uint32_t timeout, std::function<void()> &&f) {  // NOLINT
   App.scheduler.set_timeout(this, "", timeout, std::move(f));
 }
@@ -153,6 +186,20 @@ bool Component::has_overridden_loop() const {
   return loop_overridden || call_loop_overridden;
 }
 
+void Component::disable_loop() { this->loop_enabled_ = false; }
+void ICACHE_RAM_ATTR Component::enable_loop() {
+  this->loop_enabled_ = true;
+  App.wake_loop();
+}
+bool Component::is_loop_enabled() const { return this->loop_enabled_; }
+#ifdef USE_COMPONENT_PROFILER
+const char *Component::get_component_source() const {
+  if (this->component_source_ == nullptr)
+    return "<unknown>";
+  return this->component_source_;
+}
+#endif
+
 PollingComponent::PollingComponent(uint32_t update_interval) : Component(), update_interval_(update_interval) {}
 
 void PollingComponent::call_setup() {
@@ -167,20 +214,37 @@ uint32_t PollingComponent::get_update_interval() const { return this->update_int
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
 const std::string &Nameable::get_name() const { return this->name_; }
+static uint32_t nameable_key_generation = 0;
 void Nameable::set_name(const std::string &name) {
   this->name_ = name;
-  this->calc_object_id_();
+  this->has_object_id_ = false;
+  this->has_object_id_hash_ = false;
+  nameable_key_generation++;
 }
-Nameable::Nameable(const std::string &name) : name_(name) { this->calc_object_id_(); }
+Nameable::Nameable(const std::string &name) : name_(name) {}
 
-const std::string &Nameable::get_object_id() { return this->object_id_; }
+const std::string &Nameable::get_object_id() {
+  if (!this->has_object_id_) {
+    this->object_id_ = sanitize_string_allowlist(to_lowercase_underscore(this->name_), HOSTNAME_CHARACTER_ALLOWLIST);
+    this->has_object_id_ = true;
+  }
+  return this->object_id_;
+}
 bool Nameable::is_internal() const { return this->internal_; }
 void Nameable::set_internal(bool internal) { this->internal_ = internal; }
-void Nameable::calc_object_id_() {
-  this->object_id_ = sanitize_string_allowlist(to_lowercase_underscore(this->name_), HOSTNAME_CHARACTER_ALLOWLIST);
-  // FNV-1 hash
-  this->object_id_hash_ = fnv1_hash(this->object_id_);
+uint32_t Nameable::get_object_id_hash() {
+  if (!this->has_object_id_hash_) {
+    // FNV-1 hash
+    this->object_id_hash_ = fnv1_hash(this->get_object_id());
+    this->has_object_id_hash_ = true;
+  }
+  return this->object_id_hash_;
+}
+void Nameable::set_object_id_hash(uint32_t object_id_hash) {
+  this->object_id_hash_ = object_id_hash;
+  this->has_object_id_hash_ = true;
+  nameable_key_generation++;
 }
-uint32_t Nameable::get_object_id_hash() { return this->object_id_hash_; }
+uint32_t Nameable::get_key_generation() { return nameable_key_generation; }
 
 }  // namespace esphome
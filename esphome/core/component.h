@@ -5,6 +5,7 @@
 #include "Arduino.h"
 
 #include "esphome/core/optional.h"
+#include "esphome/core/profiler.h"
 
 namespace esphome {
 
@@ -128,6 +129,26 @@ class Component {
 
   bool has_overridden_loop() const;
 
+  /** Stop calling loop() for this component until enable_loop() is called.
+   *
+   * Event-driven components can use this to tell the application that they have no loop() work to do,
+   * which allows a tickless main loop to sleep until the next scheduled item or wake-up.
+   */
+  void disable_loop();
+
+  /// Resume calling loop() for this component. Safe to call from ISRs, this also wakes up the main loop.
+  void enable_loop();
+
+  bool is_loop_enabled() const;
+
+#ifdef USE_COMPONENT_PROFILER
+  /// Set where this component was defined (its configuration ID), used to identify it in profiling output.
+  void set_component_source(const char *source) { this->component_source_ = source; }
+  const char *get_component_source() const;
+  const RuntimeStats &get_setup_stats() const { return this->setup_stats_; }
+  const RuntimeStats &get_loop_stats() const { return this->loop_stats_; }
+#endif
+
  protected:
   virtual void call_loop();
   virtual void call_setup();
@@ -148,6 +169,9 @@ class Component {
    */
   void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);  // NOLINT
 
+  /// Overload for string literal names, this avoids constructing a std::string for every call.
+  void set_interval(const char *name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+
   void set_interval(uint32_t interval, std::function<void()> &&f);  // NOLINT
 
   /** Cancel an interval function.
@@ -156,6 +180,7 @@ class Component {
    * @return Whether an interval functions was deleted.
    */
   bool cancel_interval(const std::string &name);  // NOLINT
+  bool cancel_interval(const char *name);         // NOLINT
 
   void set_timeout(uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
@@ -175,12 +200,16 @@ class Component {
    */
   void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
+  /// Overload for string literal names, this avoids constructing a std::string for every call.
+  void set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+
   /** Cancel a timeout function.
    *
    * @param name The identifier for this timeout function.
    * @return Whether a timeout functions was deleted.
    */
   bool cancel_timeout(const std::string &name);  // NOLINT
+  bool cancel_timeout(const char *name);         // NOLINT
 
   /** Defer a callback to the next loop() call.
    *
@@ -190,15 +219,23 @@ class Component {
    * @param f The callback.
    */
   void defer(const std::string &name, std::function<void()> &&f);  // NOLINT
+  void defer(const char *name, std::function<void()> &&f);         // NOLINT
 
   /// Defer a callback to the next loop() call.
   void defer(std::function<void()> &&f);  // NOLINT
 
   /// Cancel a defer callback using the specified name, name must not be empty.
   bool cancel_defer(const std::string &name);  // NOLINT
+  bool cancel_defer(const char *name);         // NOLINT
 
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
+  volatile bool loop_enabled_{true};
+#ifdef USE_COMPONENT_PROFILER
+  const char *component_source_{nullptr};
+  RuntimeStats setup_stats_;
+  RuntimeStats loop_stats_;
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -249,7 +286,12 @@ class Nameable {
   void set_name(const std::string &name);
   /// Get the sanitized name of this nameable as an ID. Caching it internally.
   const std::string &get_object_id();
+  /// Get the FNV-1 hash of the object ID, which is the key of this nameable in the native API.
   uint32_t get_object_id_hash();
+  /// Set the object ID hash computed at compile time, so that it doesn't have to be hashed at runtime.
+  void set_object_id_hash(uint32_t object_id_hash);
+  /// Incremented whenever the object ID hash of any nameable changes, for the entity lookups in Application.
+  static uint32_t get_key_generation();
 
   bool is_internal() const;
   void set_internal(bool internal);
@@ -257,11 +299,11 @@ class Nameable {
  protected:
   virtual uint32_t hash_base() = 0;
 
-  void calc_object_id_();
-
   std::string name_;
   std::string object_id_;
-  uint32_t object_id_hash_;
+  uint32_t object_id_hash_{0};
+  bool has_object_id_{false};
+  bool has_object_id_hash_{false};
   bool internal_{false};
 };
 
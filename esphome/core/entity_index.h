@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "esphome/core/component.h"
+
+namespace esphome {
+
+/** Lookup of the entities of one domain by their object ID hash, the key used by the native API.
+ *
+ * The keys are collected and sorted on the first lookup after entities were added, which happens once all of them
+ * are registered and named. Lookups are then a binary search over the sorted keys instead of a linear scan over all
+ * entities. Renaming any entity changes Nameable::get_key_generation(), so the next lookup sorts the keys again.
+ */
+template<typename T> class EntityIndex {
+ public:
+  void add(T *obj) {
+    this->entries_.push_back(Entry{0, obj});
+    this->sorted_ = false;
+  }
+
+  /// Find the first entity with the given key, skipping internal entities unless include_internal is set.
+  T *find(uint32_t key, bool include_internal) {
+    if (!this->sorted_ || this->key_generation_ != Nameable::get_key_generation())
+      this->sort_();
+    auto it = std::lower_bound(this->entries_.begin(), this->entries_.end(), key,
+                               [](const Entry &entry, uint32_t key) { return entry.key < key; });
+    for (; it != this->entries_.end() && it->key == key; ++it) {
+      if (include_internal || !it->obj->is_internal())
+        return it->obj;
+    }
+    return nullptr;
+  }
+
+ protected:
+  struct Entry {
+    uint32_t key;
+    T *obj;
+  };
+
+  void sort_() {
+    for (auto &entry : this->entries_)
+      entry.key = entry.obj->get_object_id_hash();
+    // Stable, so entities with the same key are still found in registration order
+    std::stable_sort(this->entries_.begin(), this->entries_.end(),
+                     [](const Entry &a, const Entry &b) { return a.key < b.key; });
+    this->sorted_ = true;
+    this->key_generation_ = Nameable::get_key_generation();
+  }
+
+  std::vector<Entry> entries_;
+  bool sorted_{true};
+  uint32_t key_generation_{0};
+};
+
+}  // namespace esphome
@@ -256,6 +256,14 @@ uint32_t fnv1_hash(const std::string &str) {
   }
   return hash;
 }
+uint32_t fnv1_hash(const char *str) {
+  uint32_t hash = 2166136261UL;
+  for (; *str != '\0'; str++) {
+    hash *= 16777619UL;
+    hash ^= *str;
+  }
+  return hash;
+}
 bool str_equals_case_insensitive(const std::string &a, const std::string &b) {
   return strcasecmp(a.c_str(), b.c_str()) == 0;
 }
@@ -303,6 +303,63 @@ template<typename T> class Deduplicator {
   T last_value_{};
 };
 
+/** A first-in, first-out buffer of up to a fixed number of values.
+ *
+ * Memory is only allocated when the capacity is set, so unlike std::queue or std::deque, pushing and popping never
+ * allocates. Index 0 is the oldest value.
+ */
+template<typename T> class FixedRingBuffer {
+ public:
+  FixedRingBuffer() = default;
+  explicit FixedRingBuffer(size_t capacity) { this->set_capacity(capacity); }
+
+  /// Change the capacity, which removes all values.
+  void set_capacity(size_t capacity) {
+    this->buffer_.reset(new T[capacity]);
+    this->capacity_ = capacity;
+    this->clear();
+  }
+  void clear() {
+    this->head_ = 0;
+    this->size_ = 0;
+  }
+
+  size_t capacity() const { return this->capacity_; }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  bool full() const { return this->size_ == this->capacity_; }
+
+  /// Add a value after the newest one. The buffer must not be full.
+  void push(const T &value) {
+    size_t tail = this->head_ + this->size_;
+    if (tail >= this->capacity_)
+      tail -= this->capacity_;
+    this->buffer_[tail] = value;
+    this->size_++;
+  }
+  /// Remove and return the oldest value. The buffer must not be empty.
+  T pop() {
+    T value = this->buffer_[this->head_];
+    if (++this->head_ == this->capacity_)
+      this->head_ = 0;
+    this->size_--;
+    return value;
+  }
+  const T &front() const { return this->buffer_[this->head_]; }
+  const T &operator[](size_t index) const {
+    size_t at = this->head_ + index;
+    if (at >= this->capacity_)
+      at -= this->capacity_;
+    return this->buffer_[at];
+  }
+
+ protected:
+  std::unique_ptr<T[]> buffer_;
+  size_t capacity_{0};
+  size_t head_{0};
+  size_t size_{0};
+};
+
 template<typename T> class Parented {
  public:
   Parented() {}
@@ -316,5 +373,6 @@ template<typename T> class Parented {
 };
 
 uint32_t fnv1_hash(const std::string &str);
+uint32_t fnv1_hash(const char *str);
 
 }  // namespace esphome
@@ -0,0 +1,200 @@
+#include "esphome/core/preference_log.h"
+#include <cstring>
+
+namespace esphome {
+
+static const uint32_t SECTOR_MAGIC = 0x50524546;  // "PREF"
+static const size_t SECTOR_HEADER_WORDS = 3;
+static const size_t SECTOR_HEADER_SIZE = SECTOR_HEADER_WORDS * 4;
+/// Record header and checksum words.
+static const size_t RECORD_OVERHEAD = 8;
+static const uint32_t ERASED_WORD = 0xFFFFFFFF;
+/// Clean gaps up to this many words are written along with the dirty words around them, which is no larger than
+/// starting a new record.
+static const size_t MERGE_GAP_WORDS = 2;
+
+static uint32_t record_checksum(uint32_t header, const uint32_t *data, size_t words) {
+  uint32_t hash = 2166136261UL ^ header;
+  for (size_t i = 0; i < words; i++) {
+    hash *= 16777619UL;
+    hash ^= data[i];
+  }
+  return hash;
+}
+
+PreferenceLog::PreferenceLog(PreferenceFlash *flash, uint32_t *image, size_t image_words)
+    : flash_(flash), image_(image), image_words_(image_words) {
+  this->dirty_words_ = new uint32_t[(image_words + 31) / 32]();
+  // No usable active sector yet, the first sync() starts at sector 0
+  this->active_sector_ = flash->get_sector_count() - 1;
+  this->write_offset_ = flash->get_sector_size();
+}
+
+bool PreferenceLog::load() {
+  const size_t count = this->flash_->get_sector_count();
+  auto *scratch = new uint32_t[this->image_words_];
+  bool found = false;
+  // Try the sectors from newest to oldest, until one holds a complete image
+  uint32_t below = UINT32_MAX;
+  while (!found) {
+    bool any = false;
+    size_t newest = 0;
+    uint32_t newest_sequence = 0;
+    for (size_t sector = 0; sector < count; sector++) {
+      uint32_t header[SECTOR_HEADER_WORDS];
+      if (!this->flash_->read(sector, 0, header, SECTOR_HEADER_WORDS))
+        continue;
+      if (header[0] != SECTOR_MAGIC || header[2] != ~header[1])
+        continue;
+      if (header[1] > this->sequence_)
+        this->sequence_ = header[1];
+      if (header[1] < below && (!any || header[1] > newest_sequence)) {
+        any = true;
+        newest = sector;
+        newest_sequence = header[1];
+      }
+    }
+    if (!any)
+      break;
+    below = newest_sequence;
+    found = this->load_sector_(newest, scratch);
+  }
+  delete[] scratch;
+  return found;
+}
+
+bool PreferenceLog::load_sector_(size_t sector, uint32_t *scratch) {
+  const size_t sector_size = this->flash_->get_sector_size();
+  size_t offset = SECTOR_HEADER_SIZE;
+  bool has_snapshot = false;
+  while (offset + RECORD_OVERHEAD <= sector_size) {
+    uint32_t header;
+    if (!this->flash_->read(sector, offset, &header, 1))
+      return false;
+    if (header == ERASED_WORD)
+      break;
+
+    const size_t start = header >> 16;
+    const size_t words = header & 0xFFFF;
+    uint32_t checksum;
+    bool valid = words != 0 && start + words <= this->image_words_ &&
+                 offset + RECORD_OVERHEAD + words * 4 <= sector_size &&
+                 this->flash_->read(sector, offset + 4, scratch, words) &&
+                 this->flash_->read(sector, offset + 4 + words * 4, &checksum, 1) &&
+                 checksum == record_checksum(header, scratch, words);
+    if (!has_snapshot && (!valid || start != 0 || words != this->image_words_))
+      return false;
+    if (!valid) {
+      // Interrupted write, nothing can be appended after it anymore
+      offset = sector_size;
+      break;
+    }
+
+    memcpy(this->image_ + start, scratch, words * 4);
+    offset += RECORD_OVERHEAD + words * 4;
+    has_snapshot = true;
+  }
+  if (!has_snapshot)
+    return false;
+
+  this->active_sector_ = sector;
+  this->write_offset_ = offset;
+  return true;
+}
+
+void PreferenceLog::mark_dirty(size_t start, size_t words) {
+  for (size_t i = start; i < start + words && i < this->image_words_; i++) {
+    this->dirty_words_[i / 32] |= 1UL << (i % 32);
+    this->has_dirty_ = true;
+  }
+}
+
+void PreferenceLog::clear_dirty_() {
+  memset(this->dirty_words_, 0, (this->image_words_ + 31) / 32 * 4);
+  this->has_dirty_ = false;
+}
+
+bool PreferenceLog::sync() {
+  if (!this->has_dirty_)
+    return true;
+
+  this->stats_.syncs++;
+  size_t i = 0;
+  while (i < this->image_words_) {
+    if (!this->is_word_dirty_(i)) {
+      i++;
+      continue;
+    }
+    size_t last_dirty = i;
+    for (size_t j = i + 1; j < this->image_words_ && j - last_dirty <= MERGE_GAP_WORDS + 1; j++) {
+      if (this->is_word_dirty_(j))
+        last_dirty = j;
+    }
+    if (!this->append_(i, last_dirty + 1 - i))
+      return false;
+    if (!this->has_dirty_) {
+      // Rotated to a new sector, its snapshot already contains all changes
+      return true;
+    }
+    i = last_dirty + 1;
+  }
+  this->clear_dirty_();
+  return true;
+}
+
+bool PreferenceLog::append_(size_t start, size_t words) {
+  const size_t sector_size = this->flash_->get_sector_size();
+  if (this->write_offset_ + RECORD_OVERHEAD + words * 4 > sector_size)
+    return this->rotate_();
+
+  if (!this->write_record_(start, words)) {
+    // Don't append after a failed write, the next sync() starts a new sector
+    this->write_offset_ = sector_size;
+    return false;
+  }
+  return true;
+}
+
+bool PreferenceLog::write_record_(size_t start, size_t words) {
+  const uint32_t header = (start << 16) | words;
+  const uint32_t checksum = record_checksum(header, this->image_ + start, words);
+  const size_t offset = this->write_offset_;
+  // The checksum is written last, so an interrupted write is detected when loading
+  bool ok = this->flash_->write(this->active_sector_, offset, &header, 1) &&
+            this->flash_->write(this->active_sector_, offset + 4, this->image_ + start, words) &&
+            this->flash_->write(this->active_sector_, offset + 4 + words * 4, &checksum, 1);
+  this->stats_.writes++;
+  this->stats_.bytes_written += RECORD_OVERHEAD + words * 4;
+  if (ok)
+    this->write_offset_ = offset + RECORD_OVERHEAD + words * 4;
+  return ok;
+}
+
+bool PreferenceLog::rotate_() {
+  const size_t sector_size = this->flash_->get_sector_size();
+  this->active_sector_ = (this->active_sector_ + 1) % this->flash_->get_sector_count();
+  this->write_offset_ = sector_size;
+
+  this->stats_.erases++;
+  if (!this->flash_->erase(this->active_sector_))
+    return false;
+
+  // Snapshot first and header last, so that a valid header always means a complete snapshot
+  this->write_offset_ = SECTOR_HEADER_SIZE;
+  if (!this->write_record_(0, this->image_words_)) {
+    this->write_offset_ = sector_size;
+    return false;
+  }
+  const uint32_t sequence = this->sequence_ + 1;
+  const uint32_t header[SECTOR_HEADER_WORDS] = {SECTOR_MAGIC, sequence, ~sequence};
+  this->stats_.bytes_written += SECTOR_HEADER_SIZE;
+  if (!this->flash_->write(this->active_sector_, 0, header, SECTOR_HEADER_WORDS)) {
+    this->write_offset_ = sector_size;
+    return false;
+  }
+  this->sequence_ = sequence;
+  this->clear_dirty_();
+  return true;
+}
+
+}  // namespace esphome
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+
+/// Counters of the writes that reached the underlying storage, for checking flash wear.
+struct PreferenceWriteStats {
+  /// Number of sync() calls that had something to write.
+  uint32_t syncs{0};
+  /// Number of records (or NVS blobs) written.
+  uint32_t writes{0};
+  /// Number of bytes written, including record headers.
+  uint32_t bytes_written{0};
+  /// Number of sectors erased.
+  uint32_t erases{0};
+};
+
+/// A number of equally sized flash sectors that a PreferenceLog is stored in.
+class PreferenceFlash {
+ public:
+  /// The size of a sector in bytes, a multiple of 4.
+  virtual size_t get_sector_size() const = 0;
+  virtual size_t get_sector_count() const = 0;
+  /// Read words 32-bit words at byte offset of sector.
+  virtual bool read(size_t sector, size_t offset, uint32_t *data, size_t words) = 0;
+  /// Program words 32-bit words at byte offset of sector, which can only clear bits of the erased (0xFF) state.
+  virtual bool write(size_t sector, size_t offset, const uint32_t *data, size_t words) = 0;
+  virtual bool erase(size_t sector) = 0;
+};
+
+/** A log-structured, wear-leveled store for the in-memory preference image.
+ *
+ * Instead of erasing and rewriting a sector for every change, changed word ranges of the image are appended as
+ * records to the active sector. Only when that sector is full, the next sector of the ring is erased and starts
+ * with a snapshot of the whole image, which makes all older sectors garbage. Those are not touched again until the
+ * ring wraps around to them, so erases are spread over all sectors and happen once per sector's worth of changes.
+ *
+ * Sector layout: a header (magic, sequence number, inverted sequence number) followed by records. A record is a
+ * word holding the start offset and length (in words) of the range, the data and a checksum word. The header is
+ * written after the snapshot record, so a sector with a valid header always holds a complete image. A record that
+ * was only partially written because of a power loss fails its checksum and ends the log of that sector.
+ */
+class PreferenceLog {
+ public:
+  /// A snapshot of the image (image_words * 4 + 20 bytes) has to fit into one sector.
+  PreferenceLog(PreferenceFlash *flash, uint32_t *image, size_t image_words);
+
+  /** Restore the image from the newest valid sector.
+   *
+   * @return Whether a valid log was found. If not, the image is left untouched.
+   */
+  bool load();
+
+  /// Mark a range of the image as changed, to be written by the next sync().
+  void mark_dirty(size_t start, size_t words);
+  bool is_dirty() const { return this->has_dirty_; }
+
+  /// Append all changed ranges of the image to flash, rotating to the next sector if the active one is full.
+  bool sync();
+
+  const PreferenceWriteStats &get_stats() const { return this->stats_; }
+  size_t get_active_sector() const { return this->active_sector_; }
+  /// The number of bytes used in the active sector.
+  size_t get_used_bytes() const { return this->write_offset_; }
+
+ protected:
+  bool load_sector_(size_t sector, uint32_t *scratch);
+  bool append_(size_t start, size_t words);
+  bool write_record_(size_t start, size_t words);
+  bool rotate_();
+  void clear_dirty_();
+  bool is_word_dirty_(size_t index) const { return this->dirty_words_[index / 32] & (1UL << (index % 32)); }
+
+  PreferenceFlash *flash_;
+  uint32_t *image_;
+  size_t image_words_;
+  /// Bitmap of the changed words of the image.
+  uint32_t *dirty_words_;
+  bool has_dirty_{false};
+  size_t active_sector_;
+  /// Byte offset of the next record in the active sector, the sector size if there is no usable active sector.
+  size_t write_offset_;
+  uint32_t sequence_{0};
+  PreferenceWriteStats stats_;
+};
+
+}  // namespace esphome
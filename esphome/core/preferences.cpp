@@ -73,8 +73,6 @@ static inline bool esp_rtc_user_mem_read(uint32_t index, uint32_t *dest) {
   return true;
 }
 
-static bool esp8266_flash_dirty = false;
-
 static inline bool esp_rtc_user_mem_write(uint32_t index, uint32_t value) {
   if (index >= ESP_RTC_USER_MEM_SIZE_WORDS) {
     return false;
@@ -100,29 +98,52 @@ static const uint32_t get_esp8266_flash_sector() {
 }
 static const uint32_t get_esp8266_flash_address() { return get_esp8266_flash_sector() * SPI_FLASH_SEC_SIZE; }
 
-void ESPPreferences::save_esp8266_flash_() {
-  if (!esp8266_flash_dirty)
-    return;
-
-  ESP_LOGVV(TAG, "Saving preferences to flash...");
-  SpiFlashOpResult erase_res, write_res = SPI_FLASH_RESULT_OK;
-  {
+/// The preference sectors, the last one is the sector after the SPIFFS area and the others precede it.
+class ESP8266PreferenceFlash : public PreferenceFlash {
+ public:
+  explicit ESP8266PreferenceFlash(uint32_t sectors)
+      : first_sector_(get_esp8266_flash_sector() + 1 - sectors), sectors_(sectors) {}
+  size_t get_sector_size() const override { return SPI_FLASH_SEC_SIZE; }
+  size_t get_sector_count() const override { return this->sectors_; }
+  bool read(size_t sector, size_t offset, uint32_t *data, size_t words) override {
     InterruptLock lock;
-    erase_res = spi_flash_erase_sector(get_esp8266_flash_sector());
-    if (erase_res == SPI_FLASH_RESULT_OK) {
-      write_res = spi_flash_write(get_esp8266_flash_address(), this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE * 4);
-    }
+    return spi_flash_read(this->get_address_(sector, offset), data, words * 4) == SPI_FLASH_RESULT_OK;
   }
-  if (erase_res != SPI_FLASH_RESULT_OK) {
-    ESP_LOGV(TAG, "Erase ESP8266 flash failed!");
-    return;
+  bool write(size_t sector, size_t offset, const uint32_t *data, size_t words) override {
+    InterruptLock lock;
+    return spi_flash_write(this->get_address_(sector, offset), const_cast<uint32_t *>(data), words * 4) ==
+           SPI_FLASH_RESULT_OK;
   }
-  if (write_res != SPI_FLASH_RESULT_OK) {
-    ESP_LOGV(TAG, "Write ESP8266 flash failed!");
-    return;
+  bool erase(size_t sector) override {
+    InterruptLock lock;
+    return spi_flash_erase_sector(this->first_sector_ + sector) == SPI_FLASH_RESULT_OK;
   }
 
-  esp8266_flash_dirty = false;
+ protected:
+  uint32_t get_address_(size_t sector, size_t offset) const {
+    return (this->first_sector_ + sector) * SPI_FLASH_SEC_SIZE + offset;
+  }
+
+  uint32_t first_sector_;
+  uint32_t sectors_;
+};
+
+bool ESPPreferences::sync() {
+  if (this->flash_log_ == nullptr || !this->flash_log_->is_dirty())
+    return true;
+
+  ESP_LOGVV(TAG, "Saving preferences to flash...");
+  if (!this->flash_log_->sync()) {
+    ESP_LOGV(TAG, "Write ESP8266 flash failed!");
+    return false;
+  }
+  return true;
+}
+const PreferenceWriteStats &ESPPreferences::get_write_stats() const {
+  static const PreferenceWriteStats EMPTY_STATS;
+  if (this->flash_log_ == nullptr)
+    return EMPTY_STATS;
+  return this->flash_log_->get_stats();
 }
 
 bool ESPPreferenceObject::save_internal_() {
@@ -134,10 +155,11 @@ bool ESPPreferenceObject::save_internal_() {
       uint32_t v = this->data_[i];
       uint32_t *ptr = &global_preferences.flash_storage_[j];
       if (*ptr != v)
-        esp8266_flash_dirty = true;
+        global_preferences.flash_log_->mark_dirty(j, 1);
       *ptr = v;
     }
-    global_preferences.save_esp8266_flash_();
+    if (global_preferences.flash_write_interval_ == 0)
+      return global_preferences.sync();
     return true;
   }
 
@@ -176,7 +198,10 @@ void ESPPreferences::begin() {
   this->flash_storage_ = new uint32_t[ESP8266_FLASH_STORAGE_SIZE];
   ESP_LOGVV(TAG, "Loading preferences from flash...");
 
-  {
+  auto *flash = new ESP8266PreferenceFlash(this->flash_sectors_);
+  this->flash_log_ = new PreferenceLog(flash, this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE);
+  if (!this->flash_log_->load()) {
+    // Not written as a log yet, read the plain image older versions stored in the sector after SPIFFS
     InterruptLock lock;
     spi_flash_read(get_esp8266_flash_address(), this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE * 4);
   }
@@ -227,21 +252,55 @@ bool ESPPreferences::is_prevent_write() { return this->prevent_write_; }
 #endif
 
 #ifdef ARDUINO_ARCH_ESP32
+/// Write a blob to NVS unless it already holds the same data.
+static bool nvs_save_blob(uint32_t handle, uint32_t offset, const uint8_t *data, size_t len,
+                          PreferenceWriteStats &stats) {
+  char key[32];
+  sprintf(key, "%u", offset);
+
+  size_t actual_len;
+  if (nvs_get_blob(handle, key, nullptr, &actual_len) == ESP_OK && actual_len == len) {
+    std::vector<uint8_t> stored(len);
+    if (nvs_get_blob(handle, key, stored.data(), &actual_len) == ESP_OK && memcmp(stored.data(), data, len) == 0) {
+      ESP_LOGVV(TAG, "NVS data not changed, skipping write of '%s'", key);
+      return true;
+    }
+  }
+
+  esp_err_t err = nvs_set_blob(handle, key, data, len);
+  if (err) {
+    ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", key, len, esp_err_to_name(err));
+    return false;
+  }
+  stats.writes++;
+  stats.bytes_written += len;
+  return true;
+}
+
 bool ESPPreferenceObject::save_internal_() {
   if (global_preferences.nvs_handle_ == 0)
     return false;
 
-  char key[32];
-  sprintf(key, "%u", this->offset_);
+  const auto *data = reinterpret_cast<const uint8_t *>(this->data_);
   uint32_t len = (this->length_words_ + 1) * 4;
-  esp_err_t err = nvs_set_blob(global_preferences.nvs_handle_, key, this->data_, len);
-  if (err) {
-    ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", key, len, esp_err_to_name(err));
-    return false;
+  if (global_preferences.flash_write_interval_ != 0) {
+    for (auto &pending : global_preferences.pending_save_) {
+      if (pending.key == this->offset_) {
+        pending.data.assign(data, data + len);
+        return true;
+      }
+    }
+    global_preferences.pending_save_.push_back({this->offset_, std::vector<uint8_t>(data, data + len)});
+    return true;
   }
-  err = nvs_commit(global_preferences.nvs_handle_);
+
+  auto &stats = global_preferences.write_stats_;
+  stats.syncs++;
+  if (!nvs_save_blob(global_preferences.nvs_handle_, this->offset_, data, len, stats))
+    return false;
+  esp_err_t err = nvs_commit(global_preferences.nvs_handle_);
   if (err) {
-    ESP_LOGV(TAG, "nvs_commit('%s', len=%u) failed: %s", key, len, esp_err_to_name(err));
+    ESP_LOGV(TAG, "nvs_commit('%u', len=%u) failed: %s", this->offset_, len, esp_err_to_name(err));
     return false;
   }
   return true;
@@ -250,9 +309,18 @@ bool ESPPreferenceObject::load_internal_() {
   if (global_preferences.nvs_handle_ == 0)
     return false;
 
+  uint32_t len = (this->length_words_ + 1) * 4;
+  for (auto &pending : global_preferences.pending_save_) {
+    if (pending.key == this->offset_) {
+      if (pending.data.size() != len)
+        return false;
+      memcpy(this->data_, pending.data.data(), len);
+      return true;
+    }
+  }
+
   char key[32];
   sprintf(key, "%u", this->offset_);
-  uint32_t len = (this->length_words_ + 1) * 4;
 
   uint32_t actual_len;
   esp_err_t err = nvs_get_blob(global_preferences.nvs_handle_, key, nullptr, &actual_len);
@@ -293,6 +361,29 @@ ESPPreferenceObject ESPPreferences::make_preference(size_t length, uint32_t type
   this->current_offset_++;
   return pref;
 }
+
+bool ESPPreferences::sync() {
+  if (this->pending_save_.empty())
+    return true;
+  if (this->nvs_handle_ == 0)
+    return false;
+
+  ESP_LOGVV(TAG, "Saving %u preferences to NVS...", this->pending_save_.size());
+  this->write_stats_.syncs++;
+  bool success = true;
+  for (auto &pending : this->pending_save_) {
+    if (!nvs_save_blob(this->nvs_handle_, pending.key, pending.data.data(), pending.data.size(), this->write_stats_))
+      success = false;
+  }
+  this->pending_save_.clear();
+  esp_err_t err = nvs_commit(this->nvs_handle_);
+  if (err) {
+    ESP_LOGV(TAG, "nvs_commit() failed: %s", esp_err_to_name(err));
+    return false;
+  }
+  return success;
+}
+const PreferenceWriteStats &ESPPreferences::get_write_stats() const { return this->write_stats_; }
 #endif
 uint32_t ESPPreferenceObject::calculate_crc_() const {
   uint32_t crc = this->type_;
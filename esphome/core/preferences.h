@@ -1,9 +1,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "esphome/core/esphal.h"
 #include "esphome/core/defines.h"
+#include "esphome/core/preference_log.h"
 
 namespace esphome {
 
@@ -56,7 +58,29 @@ class ESPPreferences {
   ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash = DEFAULT_IN_FLASH);
   template<typename T> ESPPreferenceObject make_preference(uint32_t type, bool in_flash = DEFAULT_IN_FLASH);
 
+  /** Set how often changed preferences are written to flash, in ms.
+   *
+   * With 0 (the default), every change is written immediately. Otherwise changes are only kept in memory until
+   * the next sync(), which the preferences component calls in this interval and the application calls on shutdown.
+   * Many quick changes of the same value (like a frequently toggled relay) are then coalesced into one write.
+   */
+  void set_flash_write_interval(uint32_t flash_write_interval) { this->flash_write_interval_ = flash_write_interval; }
+  uint32_t get_flash_write_interval() const { return this->flash_write_interval_; }
+
+  /// Write all pending changes to flash.
+  bool sync();
+
+  const PreferenceWriteStats &get_write_stats() const;
+
 #ifdef ARDUINO_ARCH_ESP8266
+  /** Set the number of flash sectors the preferences are wear-leveled over, must be called before begin().
+   *
+   * The first sector is the one after the SPIFFS area (where preferences were always stored), any additional ones
+   * are taken from the end of the (unused) SPIFFS area.
+   */
+  void set_flash_sectors(uint32_t flash_sectors) { this->flash_sectors_ = flash_sectors; }
+  uint32_t get_flash_sectors() const { return this->flash_sectors_; }
+
   /** On the ESP8266, we can't override the first 128 bytes during OTA uploads
    * as the eboot parameters are stored there. Writing there during an OTA upload
    * would invalidate applying the new firmware. During normal operation, we use
@@ -72,14 +96,24 @@ class ESPPreferences {
   friend ESPPreferenceObject;
 
   uint32_t current_offset_;
+  uint32_t flash_write_interval_{0};
 #ifdef ARDUINO_ARCH_ESP32
+  struct PendingSave {
+    size_t key;
+    std::vector<uint8_t> data;
+  };
+
   uint32_t nvs_handle_;
+  /// Blobs that are only written with the next sync().
+  std::vector<PendingSave> pending_save_;
+  PreferenceWriteStats write_stats_;
 #endif
 #ifdef ARDUINO_ARCH_ESP8266
-  void save_esp8266_flash_();
   bool prevent_write_{false};
   uint32_t *flash_storage_;
   uint32_t current_flash_offset_;
+  uint32_t flash_sectors_{1};
+  PreferenceLog *flash_log_{nullptr};
 #endif
 };
 
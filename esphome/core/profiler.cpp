@@ -0,0 +1,39 @@
+#include "esphome/core/profiler.h"
+
+#ifdef USE_COMPONENT_PROFILER
+
+namespace esphome {
+
+void RuntimeStats::record(uint32_t duration_us) {
+  this->count_++;
+  this->total_us_ += duration_us;
+  if (duration_us > this->max_us_)
+    this->max_us_ = duration_us;
+
+  // Bucket i holds durations in [2^(i-1), 2^i), bucket 0 only 0us
+  uint8_t bucket = 0;
+  while (duration_us != 0 && bucket < RUNTIME_STATS_BUCKETS - 1) {
+    duration_us >>= 1;
+    bucket++;
+  }
+  this->buckets_[bucket]++;
+}
+uint32_t RuntimeStats::get_p99_us() const {
+  if (this->count_ == 0)
+    return 0;
+  // Number of samples at or below the 99th percentile, rounded up
+  const uint32_t target = this->count_ - this->count_ / 100;
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < RUNTIME_STATS_BUCKETS - 1; i++) {
+    seen += this->buckets_[i];
+    if (seen >= target) {
+      const uint32_t upper = (1UL << i) - 1;
+      return upper < this->max_us_ ? upper : this->max_us_;
+    }
+  }
+  return this->max_us_;
+}
+
+}  // namespace esphome
+
+#endif  // USE_COMPONENT_PROFILER
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include "esphome/core/defines.h"
+
+#ifdef USE_COMPONENT_PROFILER
+
+namespace esphome {
+
+/// Number of power-of-two histogram buckets, the last bucket holds everything above ~4s.
+static const uint8_t RUNTIME_STATS_BUCKETS = 24;
+
+/** Execution time statistics for one kind of work, like a component's loop() or a scheduler callback.
+ *
+ * Durations are recorded into a histogram with power-of-two buckets, so that percentiles can be estimated
+ * with a fixed amount of memory.
+ */
+class RuntimeStats {
+ public:
+  void record(uint32_t duration_us);
+
+  uint32_t get_count() const { return this->count_; }
+  uint64_t get_total_us() const { return this->total_us_; }
+  uint32_t get_max_us() const { return this->max_us_; }
+  /// Estimate the 99th percentile as the upper bound of the histogram bucket it falls into.
+  uint32_t get_p99_us() const;
+
+ protected:
+  uint32_t count_{0};
+  uint64_t total_us_{0};
+  uint32_t max_us_{0};
+  uint32_t buckets_[RUNTIME_STATS_BUCKETS]{};
+};
+
+}  // namespace esphome
+
+#endif  // USE_COMPONENT_PROFILER
@@ -8,43 +8,77 @@ namespace esphome {
 static const char *TAG = "scheduler";
 
 static const uint32_t SCHEDULER_DONT_RUN = 4294967295UL;
-static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+static const uint32_t NOT_IN_HEAP = 0xFFFFFFFFUL;
+static const uint32_t MIN_INDEX_BUCKETS = 16;
+// Number of finished items kept around for reuse, so that steady-state rescheduling doesn't allocate new items.
+static const uint32_t MAX_POOLED_ITEMS = 16;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> &&func) {
+  this->set_timeout_(component, name.c_str(), timeout, std::move(func));
+}
+void HOT Scheduler::set_timeout(Component *component, const char *name, uint32_t timeout,
+                                std::function<void()> &&func) {
+  this->set_timeout_(component, name, timeout, std::move(func));
+}
+bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
+  return this->cancel_item_(component, fnv1_hash(name), SchedulerItem::TIMEOUT);
+}
+bool HOT Scheduler::cancel_timeout(Component *component, const char *name) {
+  return this->cancel_item_(component, fnv1_hash(name), SchedulerItem::TIMEOUT);
+}
+void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
+                                 std::function<void()> &&func) {
+  this->set_interval_(component, name.c_str(), interval, std::move(func));
+}
+void HOT Scheduler::set_interval(Component *component, const char *name, uint32_t interval,
+                                 std::function<void()> &&func) {
+  this->set_interval_(component, name, interval, std::move(func));
+}
+bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
+  return this->cancel_item_(component, fnv1_hash(name), SchedulerItem::INTERVAL);
+}
+bool HOT Scheduler::cancel_interval(Component *component, const char *name) {
+  return this->cancel_item_(component, fnv1_hash(name), SchedulerItem::INTERVAL);
+}
+void HOT Scheduler::set_timeout_(Component *component, const char *name, uint32_t timeout,
+                                 std::function<void()> &&func) {
   const uint32_t now = this->millis_();
+  const uint32_t name_hash = fnv1_hash(name);
 
-  if (!name.empty())
-    this->cancel_timeout(component, name);
+  if (name[0] != '\0')
+    this->cancel_item_(component, name_hash, SchedulerItem::TIMEOUT);
 
   if (timeout == SCHEDULER_DONT_RUN)
     return;
 
-  ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%u)", name.c_str(), timeout);
+  ESP_LOGVV(TAG, "set_timeout(name=0x%08X, timeout=%u)", name_hash, timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->make_item_();
   item->component = component;
-  item->name = name;
+  item->name_hash = name_hash;
   item->type = SchedulerItem::TIMEOUT;
   item->timeout = timeout;
   item->last_execution = now;
   item->last_execution_major = this->millis_major_;
   item->f = std::move(func);
   item->remove = false;
+#ifdef USE_COMPONENT_PROFILER
+  item->stats_index = this->callback_stats_index_(component, name, name_hash);
+#endif
+  this->index_insert_(item.get());
   this->push_(std::move(item));
 }
-bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
-}
-void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
-                                 std::function<void()> &&func) {
+void HOT Scheduler::set_interval_(Component *component, const char *name, uint32_t interval,
+                                  std::function<void()> &&func) {
   const uint32_t now = this->millis_();
+  const uint32_t name_hash = fnv1_hash(name);
 
-  if (!name.empty())
-    this->cancel_interval(component, name);
+  if (name[0] != '\0')
+    this->cancel_item_(component, name_hash, SchedulerItem::INTERVAL);
 
   if (interval == SCHEDULER_DONT_RUN)
     return;
@@ -54,11 +88,11 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
   if (interval != 0)
     offset = (random_uint32() % interval) / 2;
 
-  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%u, offset=%u)", name.c_str(), interval, offset);
+  ESP_LOGVV(TAG, "set_interval(name=0x%08X, interval=%u, offset=%u)", name_hash, interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->make_item_();
   item->component = component;
-  item->name = name;
+  item->name_hash = name_hash;
   item->type = SchedulerItem::INTERVAL;
   item->interval = interval;
   item->last_execution = now - offset - interval;
@@ -67,13 +101,14 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
     item->last_execution_major--;
   item->f = std::move(func);
   item->remove = false;
+#ifdef USE_COMPONENT_PROFILER
+  item->stats_index = this->callback_stats_index_(component, name, name_hash);
+#endif
+  this->index_insert_(item.get());
   this->push_(std::move(item));
 }
-bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
-}
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
-  if (this->empty_())
+  if (this->items_.empty())
     return {};
   auto &item = this->items_[0];
   const uint32_t now = this->millis_();
@@ -91,97 +126,77 @@ void ICACHE_RAM_ATTR HOT Scheduler::call() {
 
   if (now - last_print > 2000) {
     last_print = now;
-    std::vector<std::unique_ptr<SchedulerItem>> old_items;
-    ESP_LOGVV(TAG, "Items: count=%u, now=%u", this->items_.size(), now);
-    while (!this->empty_()) {
-      auto item = std::move(this->items_[0]);
+    ESP_LOGVV(TAG, "Items: count=%u, now=%u (heap order)", this->items_.size(), now);
+    for (auto &item : this->items_) {
       const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
-      ESP_LOGVV(TAG, "  %s '%s' interval=%u last_execution=%u (%u) next=%u (%u)", type, item->name.c_str(),
+      ESP_LOGVV(TAG, "  %s 0x%08X interval=%u last_execution=%u (%u) next=%u (%u)", type, item->name_hash,
                 item->interval, item->last_execution, item->last_execution_major, item->next_execution(),
                 item->next_execution_major());
-
-      this->pop_raw_();
-      old_items.push_back(std::move(item));
     }
     ESP_LOGVV(TAG, "\n");
-    this->items_ = std::move(old_items);
   }
 #endif  // ESPHOME_DEBUG_SCHEDULER
 
-  auto to_remove_was = to_remove_;
-  auto items_was = items_.size();
-  // If we have too many items to remove
-  if (to_remove_ > MAX_LOGICALLY_DELETED_ITEMS) {
-    std::vector<std::unique_ptr<SchedulerItem>> valid_items;
-    while (!this->empty_()) {
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      valid_items.push_back(std::move(item));
-    }
-    this->items_ = std::move(valid_items);
-
-    // The following should not happen unless I'm missing something
-    if (to_remove_ != 0) {
-      ESP_LOGW(TAG, "to_remove_ was %u now: %u items where %zu now %zu. Please report this", to_remove_was, to_remove_,
-               items_was, items_.size());
-      to_remove_ = 0;
-    }
-  }
-
-  while (!this->empty_()) {
-    // use scoping to indicate visibility of `item` variable
+  while (!this->items_.empty()) {
+    // use scoping to indicate visibility of `next` variable
     {
       // Don't copy-by value yet
-      auto &item = this->items_[0];
-      if ((now - item->last_execution) < item->interval)
+      auto &next = this->items_[0];
+      if ((now - next->last_execution) < next->interval)
         // Not reached timeout yet, done for this call
         break;
-      uint8_t major = item->next_execution_major();
+      uint8_t major = next->next_execution_major();
       if (this->millis_major_ - major > 1)
         break;
+    }
 
-      // Don't run on failed components
-      if (item->component != nullptr && item->component->is_failed()) {
-        this->pop_raw_();
-        continue;
-      }
+    // Take the item out of the heap before running it. It stays in the index, so a cancel
+    // from within its own callback only marks it as removed.
+    auto item = this->heap_remove_(0);
 
-#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
-      const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
-      ESP_LOGVV(TAG, "Running %s '%s' with interval=%u last_execution=%u (now=%u)", type, item->name.c_str(),
-                item->interval, item->last_execution, now);
-#endif
-
-      // Warning: During f(), a lot of stuff can happen, including:
-      //  - timeouts/intervals get added, potentially invalidating vector pointers
-      //  - timeouts/intervals get cancelled
-      item->f();
+    // Don't run on failed components
+    if (item->component != nullptr && item->component->is_failed()) {
+      this->index_remove_(item.get());
+      this->recycle_item_(std::move(item));
+      continue;
     }
 
-    {
-      // new scope, item from before might have been moved in the vector
-      auto item = std::move(this->items_[0]);
+#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+    const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
+    ESP_LOGVV(TAG, "Running %s 0x%08X with interval=%u last_execution=%u (now=%u)", type, item->name_hash,
+              item->interval, item->last_execution, now);
+#endif
 
-      // Only pop after function call, this ensures we were reachable
-      // during the function call and know if we were cancelled.
-      this->pop_raw_();
+    // Warning: During f(), a lot of stuff can happen, including:
+    //  - timeouts/intervals get added
+    //  - timeouts/intervals get cancelled, which removes them from the heap
+#ifdef USE_COMPONENT_PROFILER
+    const uint32_t start = micros();
+    item->f();
+    this->callback_stats_[item->stats_index].stats.record(micros() - start);
+#else
+    item->f();
+#endif
 
-      if (item->remove) {
-        // We were removed/cancelled in the function call, stop
-        to_remove_--;
-        continue;
-      }
+    if (item->remove) {
+      // We were cancelled in the function call, cancel_item_ already unlinked us from the index
+      this->recycle_item_(std::move(item));
+      continue;
+    }
 
-      if (item->type == SchedulerItem::INTERVAL) {
-        if (item->interval != 0) {
-          const uint32_t before = item->last_execution;
-          const uint32_t amount = (now - item->last_execution) / item->interval;
-          item->last_execution += amount * item->interval;
-          if (item->last_execution < before)
-            item->last_execution_major++;
-        }
-        this->push_(std::move(item));
+    if (item->type == SchedulerItem::INTERVAL) {
+      if (item->interval != 0) {
+        const uint32_t before = item->last_execution;
+        const uint32_t amount = (now - item->last_execution) / item->interval;
+        item->last_execution += amount * item->interval;
+        if (item->last_execution < before)
+          item->last_execution_major++;
       }
+      // Re-added after this call, otherwise an interval of 0 would run forever
+      this->push_(std::move(item));
+    } else {
+      this->index_remove_(item.get());
+      this->recycle_item_(std::move(item));
     }
   }
 
@@ -190,45 +205,173 @@ void ICACHE_RAM_ATTR HOT Scheduler::call() {
 void HOT Scheduler::process_to_add() {
   for (auto &it : this->to_add_) {
     if (it->remove) {
+      this->recycle_item_(std::move(it));
       continue;
     }
 
-    this->items_.push_back(std::move(it));
-    std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+    this->heap_push_(std::move(it));
   }
   this->to_add_.clear();
 }
-void HOT Scheduler::cleanup_() {
-  while (!this->items_.empty()) {
-    auto &item = this->items_[0];
-    if (!item->remove)
-      return;
+void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) { this->to_add_.push_back(std::move(item)); }
+bool HOT Scheduler::cancel_item_(Component *component, uint32_t name_hash, Scheduler::SchedulerItem::Type type) {
+  if (this->index_.empty())
+    return false;
+
+  bool ret = false;
+  SchedulerItem **it = &this->index_[this->index_bucket_(component, name_hash)];
+  while (*it != nullptr) {
+    SchedulerItem *item = *it;
+    if (item->component != component || item->name_hash != name_hash || item->type != type) {
+      it = &item->index_next;
+      continue;
+    }
+
+    // Unlink from the index
+    *it = item->index_next;
+    this->index_count_--;
+    item->remove = true;
+    ret = true;
+
+    // Items pending in to_add_ or currently executing are recycled by their owner
+    if (item->heap_index != NOT_IN_HEAP)
+      this->recycle_item_(this->heap_remove_(item->heap_index));
+  }
 
-    to_remove_--;
-    this->pop_raw_();
+  return ret;
+}
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::make_item_() {
+  if (this->free_items_.empty()) {
+    auto item = make_unique<SchedulerItem>();
+    item->heap_index = NOT_IN_HEAP;
+    return item;
   }
+  auto item = std::move(this->free_items_.back());
+  this->free_items_.pop_back();
+  return item;
+}
+void HOT Scheduler::heap_push_(std::unique_ptr<SchedulerItem> item) {
+  item->heap_index = this->items_.size();
+  this->items_.push_back(std::move(item));
+  this->heap_sift_up_(this->items_.size() - 1);
 }
-void HOT Scheduler::pop_raw_() {
-  std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::heap_remove_(uint32_t index) {
+  const uint32_t last = this->items_.size() - 1;
+  if (index != last)
+    this->heap_swap_(index, last);
+  auto item = std::move(this->items_.back());
   this->items_.pop_back();
+  item->heap_index = NOT_IN_HEAP;
+
+  if (index < this->items_.size()) {
+    // The item moved into the hole may need to go either way
+    if (index > 0 && SchedulerItem::cmp(this->items_[(index - 1) / 2], this->items_[index])) {
+      this->heap_sift_up_(index);
+    } else {
+      this->heap_sift_down_(index);
+    }
+  }
+  return item;
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) { this->to_add_.push_back(std::move(item)); }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
-  bool ret = false;
-  for (auto &it : this->items_)
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
-      to_remove_++;
-      it->remove = true;
-      ret = true;
+void HOT Scheduler::heap_swap_(uint32_t a, uint32_t b) {
+  std::swap(this->items_[a], this->items_[b]);
+  this->items_[a]->heap_index = a;
+  this->items_[b]->heap_index = b;
+}
+void HOT Scheduler::heap_sift_up_(uint32_t index) {
+  while (index > 0) {
+    const uint32_t parent = (index - 1) / 2;
+    if (!SchedulerItem::cmp(this->items_[parent], this->items_[index]))
+      break;
+    this->heap_swap_(index, parent);
+    index = parent;
+  }
+}
+void HOT Scheduler::heap_sift_down_(uint32_t index) {
+  const uint32_t size = this->items_.size();
+  while (true) {
+    uint32_t child = 2 * index + 1;
+    if (child >= size)
+      break;
+    if (child + 1 < size && SchedulerItem::cmp(this->items_[child], this->items_[child + 1]))
+      child++;
+    if (!SchedulerItem::cmp(this->items_[index], this->items_[child]))
+      break;
+    this->heap_swap_(index, child);
+    index = child;
+  }
+}
+uint32_t HOT Scheduler::index_bucket_(Component *component, uint32_t name_hash) const {
+  // index_ size is always a power of two
+  uint32_t hash = name_hash ^ (uint32_t(reinterpret_cast<uintptr_t>(component)) * 2654435761UL);
+  return hash & (this->index_.size() - 1);
+}
+void HOT Scheduler::index_insert_(SchedulerItem *item) {
+  if (this->index_count_ >= this->index_.size())
+    this->index_grow_();
+  SchedulerItem *&bucket = this->index_[this->index_bucket_(item->component, item->name_hash)];
+  item->index_next = bucket;
+  bucket = item;
+  this->index_count_++;
+}
+void HOT Scheduler::index_remove_(SchedulerItem *item) {
+  SchedulerItem **it = &this->index_[this->index_bucket_(item->component, item->name_hash)];
+  while (*it != nullptr) {
+    if (*it == item) {
+      *it = item->index_next;
+      this->index_count_--;
+      return;
     }
-  for (auto &it : this->to_add_)
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
-      ret = true;
+    it = &(*it)->index_next;
+  }
+}
+void Scheduler::index_grow_() {
+  std::vector<SchedulerItem *> old_index;
+  old_index.swap(this->index_);
+  this->index_.resize(std::max<uint32_t>(MIN_INDEX_BUCKETS, old_index.size() * 2), nullptr);
+  for (SchedulerItem *bucket : old_index) {
+    while (bucket != nullptr) {
+      SchedulerItem *next = bucket->index_next;
+      SchedulerItem *&new_bucket = this->index_[this->index_bucket_(bucket->component, bucket->name_hash)];
+      bucket->index_next = new_bucket;
+      new_bucket = bucket;
+      bucket = next;
     }
+  }
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  if (this->free_items_.size() >= MAX_POOLED_ITEMS)
+    return;
+  // Release the callback's captures now, not when the item is reused
+  item->f = nullptr;
+  this->free_items_.push_back(std::move(item));
+}
+#ifdef USE_COMPONENT_PROFILER
+uint32_t Scheduler::callback_stats_index_(Component *component, const char *name, uint32_t name_hash) {
+  // Binary search, every set_timeout()/set_interval() ends up here
+  auto it = std::lower_bound(this->callback_stats_order_.begin(), this->callback_stats_order_.end(), 0u,
+                             [this, component, name_hash](uint32_t index, uint32_t) {
+                               const CallbackStats &entry = this->callback_stats_[index];
+                               if (entry.component != component)
+                                 return std::less<Component *>()(entry.component, component);
+                               return entry.name_hash < name_hash;
+                             });
+  if (it != this->callback_stats_order_.end()) {
+    const CallbackStats &entry = this->callback_stats_[*it];
+    if (entry.component == component && entry.name_hash == name_hash)
+      return *it;
+  }
 
-  return ret;
+  CallbackStats entry;
+  entry.component = component;
+  entry.name_hash = name_hash;
+  entry.name = name;
+  this->callback_stats_.push_back(entry);
+  const uint32_t index = this->callback_stats_.size() - 1;
+  this->callback_stats_order_.insert(it, index);
+  return index;
 }
+#endif
 uint32_t Scheduler::millis_() {
   const uint32_t now = millis();
   if (now < this->last_millis_) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/profiler.h"
 #include <vector>
 #include <memory>
 
@@ -11,9 +12,13 @@ class Component;
 class Scheduler {
  public:
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> &&func);
+  void set_timeout(Component *component, const char *name, uint32_t timeout, std::function<void()> &&func);
   bool cancel_timeout(Component *component, const std::string &name);
+  bool cancel_timeout(Component *component, const char *name);
   void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> &&func);
+  void set_interval(Component *component, const char *name, uint32_t interval, std::function<void()> &&func);
   bool cancel_interval(Component *component, const std::string &name);
+  bool cancel_interval(Component *component, const char *name);
 
   optional<uint32_t> next_schedule_in();
 
@@ -21,19 +26,39 @@ class Scheduler {
 
   void process_to_add();
 
+#ifdef USE_COMPONENT_PROFILER
+  /// Execution time statistics of the callbacks of one component with the same name.
+  struct CallbackStats {
+    Component *component;
+    uint32_t name_hash;
+    std::string name;
+    RuntimeStats stats;
+  };
+  const std::vector<CallbackStats> &get_callback_stats() const { return this->callback_stats_; }
+#endif
+
  protected:
   struct SchedulerItem {
     Component *component;
-    std::string name;
+    /// FNV-1 hash of the name, names are never stored to avoid copying strings on every schedule.
+    uint32_t name_hash;
     enum Type { TIMEOUT, INTERVAL } type;
     union {
       uint32_t interval;
       uint32_t timeout;
     };
     uint32_t last_execution;
+    /// Only stored without a heap allocation if the callable is at most two pointers large and trivially copyable.
     std::function<void()> f;
     bool remove;
     uint8_t last_execution_major;
+    /// Position of this item in items_, or NOT_IN_HEAP while pending in to_add_ or executing.
+    uint32_t heap_index;
+    /// Next item in the same bucket of the (component, name) index.
+    SchedulerItem *index_next;
+#ifdef USE_COMPONENT_PROFILER
+    uint32_t stats_index;
+#endif
 
     inline uint32_t next_execution() { return this->last_execution + this->timeout; }
     inline uint8_t next_execution_major() {
@@ -47,21 +72,44 @@ class Scheduler {
     static bool cmp(const std::unique_ptr<SchedulerItem> &a, const std::unique_ptr<SchedulerItem> &b);
   };
 
+  void set_timeout_(Component *component, const char *name, uint32_t timeout, std::function<void()> &&func);
+  void set_interval_(Component *component, const char *name, uint32_t interval, std::function<void()> &&func);
   uint32_t millis_();
-  void cleanup_();
-  void pop_raw_();
   void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
-  bool empty_() {
-    this->cleanup_();
-    return this->items_.empty();
-  }
+  bool cancel_item_(Component *component, uint32_t name_hash, SchedulerItem::Type type);
+  /// Take an item from the pool of recycled items, only allocating if the pool is empty.
+  std::unique_ptr<SchedulerItem> make_item_();
+  /// Return an item that is no longer scheduled to the pool.
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
+
+  // Binary min-heap over items_, every item tracks its own position so it can be removed in O(log n).
+  void heap_push_(std::unique_ptr<SchedulerItem> item);
+  std::unique_ptr<SchedulerItem> heap_remove_(uint32_t index);
+  void heap_swap_(uint32_t a, uint32_t b);
+  void heap_sift_up_(uint32_t index);
+  void heap_sift_down_(uint32_t index);
+
+  // Intrusive hash index by (component, name hash), used to find items to cancel without a scan.
+  uint32_t index_bucket_(Component *component, uint32_t name_hash) const;
+  void index_insert_(SchedulerItem *item);
+  void index_remove_(SchedulerItem *item);
+  void index_grow_();
+
+#ifdef USE_COMPONENT_PROFILER
+  /// Find or create the statistics entry of the callbacks with this name, the name is only copied once.
+  uint32_t callback_stats_index_(Component *component, const char *name, uint32_t name_hash);
+  std::vector<CallbackStats> callback_stats_;
+  /// Indices into callback_stats_, sorted by component and name hash.
+  std::vector<uint32_t> callback_stats_order_;
+#endif
 
   std::vector<std::unique_ptr<SchedulerItem>> items_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  std::vector<std::unique_ptr<SchedulerItem>> free_items_;
+  std::vector<SchedulerItem *> index_;
+  uint32_t index_count_{0};
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
-  uint32_t to_remove_{0};
 };
 
 }  // namespace esphome
@@ -9,7 +9,7 @@ from esphome.const import CONF_ARDUINO_VERSION, CONF_BOARD, CONF_BOARD_FLASH_MOD
     CONF_BUILD_PATH, CONF_COMMENT, CONF_ESPHOME, CONF_INCLUDES, CONF_LIBRARIES, \
     CONF_NAME, CONF_ON_BOOT, CONF_ON_LOOP, CONF_ON_SHUTDOWN, CONF_PLATFORM, \
     CONF_PLATFORMIO_OPTIONS, CONF_PRIORITY, CONF_TRIGGER_ID, \
-    CONF_ESP8266_RESTORE_FROM_FLASH, ARDUINO_VERSION_ESP8266, \
+    CONF_ESP8266_RESTORE_FROM_FLASH, CONF_TICKLESS, ARDUINO_VERSION_ESP8266, \
     ARDUINO_VERSION_ESP32, ESP_PLATFORMS
 from esphome.core import CORE, coroutine_with_priority
 from esphome.helpers import copy_file_if_changed, walk_files
@@ -114,6 +114,7 @@ CONFIG_SCHEMA = cv.Schema({
 
     cv.SplitDefault(CONF_BOARD_FLASH_MODE, esp8266='dout'): cv.one_of(*BUILD_FLASH_MODES,
                                                                       lower=True),
+    cv.Optional(CONF_TICKLESS, default=False): cv.boolean,
     cv.Optional(CONF_ON_BOOT): automation.validate_automation({
         cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(StartupTrigger),
         cv.Optional(CONF_PRIORITY, default=600.0): cv.float_,
@@ -259,6 +260,8 @@ def to_code(config):
     cg.add_build_flag('-Wno-sign-compare')
     if config.get(CONF_ESP8266_RESTORE_FROM_FLASH, False):
         cg.add_define('USE_ESP8266_PREFERENCES_FLASH')
+    if config[CONF_TICKLESS]:
+        cg.add_define('USE_TICKLESS_LOOP')
 
     if config[CONF_INCLUDES]:
         CORE.add_job(add_includes, config[CONF_INCLUDES])
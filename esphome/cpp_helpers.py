@@ -1,9 +1,10 @@
 from esphome.const import CONF_INVERTED, CONF_MODE, CONF_NUMBER, CONF_SETUP_PRIORITY, \
     CONF_UPDATE_INTERVAL, CONF_TYPE_ID
 # pylint: disable=unused-import
-from esphome.core import coroutine, ID, CORE, ConfigType
+from esphome.core import coroutine, HexInt, ID, CORE, ConfigType
 from esphome.cpp_generator import RawExpression, add, get_variable
 from esphome.cpp_types import App, GPIOPin
+from esphome.helpers import object_id_hash
 from esphome.util import Registry, RegistryEntry
 
 
@@ -50,6 +51,14 @@ def register_component(var, config):
     yield var
 
 
+def add_object_id_hash(var, name):
+    """Set the object ID hash of the Nameable var with the given name, computed at compile time.
+
+    Setting the name resets the hash, so this has to be added after the name is set.
+    """
+    add(var.set_object_id_hash(HexInt(object_id_hash(name))))
+
+
 @coroutine
 def register_parented(var, value):
     if isinstance(value, ID):
@@ -57,6 +57,30 @@ def cpp_string_escape(string, encoding='utf-8'):
     return '"' + result + '"'
 
 
+def fnv1_hash(data):
+    """The 32-bit FNV-1 hash of a string, like fnv1_hash() in esphome/core/helpers.h."""
+    if isinstance(data, str):
+        data = data.encode('utf-8')
+    hsh = 2166136261
+    for byte in data:
+        hsh = (hsh * 16777619) & 0xFFFFFFFF
+        hsh ^= byte
+    return hsh
+
+
+def object_id(name):
+    """The object ID of an entity with the given name, like Nameable::get_object_id()."""
+    # Only ASCII characters are lowercased and kept, like ::tolower() and the hostname allowlist on the device
+    allowed = b'abcdefghijklmnopqrstuvwxyz0123456789-_'
+    data = name.encode('utf-8').lower().replace(b' ', b'_')
+    return bytes(c for c in data if c in allowed).decode('ascii')
+
+
+def object_id_hash(name):
+    """The key of an entity with the given name in the native API, like Nameable::get_object_id_hash()."""
+    return fnv1_hash(object_id(name))
+
+
 def color(the_color, message=''):
     from colorlog.escape_codes import escape_codes, parse_colors
 
@@ -23,6 +23,10 @@ from subprocess import call
 
 # Generate with
 # protoc --python_out=script/api_protobuf -I esphome/components/api/ api_options.proto
+#
+# The Python client messages (esphome/api/api_pb2.py) are generated with
+# protoc --python_out=esphome/api -I esphome/components/api/ api.proto api_options.proto
+# and the api_options_pb2 import in api_pb2.py changed to 'from esphome.api import ...'
 
 import api_options_pb2 as pb
 import google.protobuf.descriptor_pb2 as descriptor
@@ -39,6 +43,14 @@ content = prot.read_bytes()
 d = descriptor.FileDescriptorSet.FromString(content)
 
 
+def varint_size(value):
+    size = 1
+    while value >= 0x80:
+        value >>= 7
+        size += 1
+    return size
+
+
 def indent_list(text, padding='  '):
     return [padding + line for line in text.splitlines()]
 
@@ -163,6 +175,20 @@ class TypeInfo():
 
     encode_func = None
 
+    @property
+    def field_id_size(self):
+        # The wire type doesn't change the size of the encoded field key
+        return varint_size(self.number << 3)
+
+    def get_size_calculation(self, name, force=False):
+        return f'ProtoSize::{self.size_func}(total_size, {self.field_id_size}, {name}, {str(force).lower()});'
+
+    @property
+    def size_content(self):
+        return self.get_size_calculation(f'this->{self.field_name}')
+
+    size_func = None
+
     @property
     def dump_content(self):
         o = f'out.append("  {self.name}: ");\n'
@@ -190,6 +216,10 @@ class DoubleType(TypeInfo):
     default_value = '0.0'
     decode_64bit = 'value.as_double()'
     encode_func = 'encode_double'
+    size_func = 'add_fixed64_field'
+
+    def get_size_calculation(self, name, force=False):
+        return super().get_size_calculation(f'{name} != 0.0', force)
 
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
@@ -203,6 +233,10 @@ class FloatType(TypeInfo):
     default_value = '0.0f'
     decode_32bit = 'value.as_float()'
     encode_func = 'encode_float'
+    size_func = 'add_fixed32_field'
+
+    def get_size_calculation(self, name, force=False):
+        return super().get_size_calculation(f'{name} != 0.0f', force)
 
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
@@ -216,9 +250,10 @@ class Int64Type(TypeInfo):
     default_value = '0'
     decode_varint = 'value.as_int64()'
     encode_func = 'encode_int64'
+    size_func = 'add_int64_field'
 
     def dump(self, name):
-        o = f'sprintf(buffer, "%ll", {name});\n'
+        o = f'sprintf(buffer, "%lld", {name});\n'
         o += f'out.append(buffer);'
         return o
 
@@ -229,9 +264,10 @@ class UInt64Type(TypeInfo):
     default_value = '0'
     decode_varint = 'value.as_uint64()'
     encode_func = 'encode_uint64'
+    size_func = 'add_uint64_field'
 
     def dump(self, name):
-        o = f'sprintf(buffer, "%ull", {name});\n'
+        o = f'sprintf(buffer, "%llu", {name});\n'
         o += f'out.append(buffer);'
         return o
 
@@ -242,6 +278,7 @@ class Int32Type(TypeInfo):
     default_value = '0'
     decode_varint = 'value.as_int32()'
     encode_func = 'encode_int32'
+    size_func = 'add_int32_field'
 
     def dump(self, name):
         o = f'sprintf(buffer, "%d", {name});\n'
@@ -255,9 +292,13 @@ class Fixed64Type(TypeInfo):
     default_value = '0'
     decode_64bit = 'value.as_fixed64()'
     encode_func = 'encode_fixed64'
+    size_func = 'add_fixed64_field'
+
+    def get_size_calculation(self, name, force=False):
+        return super().get_size_calculation(f'{name} != 0', force)
 
     def dump(self, name):
-        o = f'sprintf(buffer, "%ull", {name});\n'
+        o = f'sprintf(buffer, "%llu", {name});\n'
         o += f'out.append(buffer);'
         return o
 
@@ -268,6 +309,10 @@ class Fixed32Type(TypeInfo):
     default_value = '0'
     decode_32bit = 'value.as_fixed32()'
     encode_func = 'encode_fixed32'
+    size_func = 'add_fixed32_field'
+
+    def get_size_calculation(self, name, force=False):
+        return super().get_size_calculation(f'{name} != 0', force)
 
     def dump(self, name):
         o = f'sprintf(buffer, "%u", {name});\n'
@@ -281,6 +326,7 @@ class BoolType(TypeInfo):
     default_value = 'false'
     decode_varint = 'value.as_bool()'
     encode_func = 'encode_bool'
+    size_func = 'add_bool_field'
 
     def dump(self, name):
         o = f'out.append(YESNO({name}));'
@@ -295,6 +341,7 @@ class StringType(TypeInfo):
     const_reference_type = 'const std::string &'
     decode_length = 'value.as_string()'
     encode_func = 'encode_string'
+    size_func = 'add_string_field'
 
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
@@ -321,6 +368,9 @@ class MessageType(TypeInfo):
     def encode_func(self):
         return f'encode_message<{self.cpp_type}>'
 
+    def get_size_calculation(self, name, force=False):
+        return f'ProtoSize::add_message_field<{self.cpp_type}>(total_size, {self.field_id_size}, {name});'
+
     @property
     def decode_length(self):
         return f'value.as_message<{self.cpp_type}>()'
@@ -338,6 +388,7 @@ class BytesType(TypeInfo):
     const_reference_type = 'const std::string &'
     decode_length = 'value.as_string()'
     encode_func = 'encode_string'
+    size_func = 'add_string_field'
 
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
@@ -350,6 +401,7 @@ class UInt32Type(TypeInfo):
     default_value = '0'
     decode_varint = 'value.as_uint32()'
     encode_func = 'encode_uint32'
+    size_func = 'add_uint32_field'
 
     def dump(self, name):
         o = f'sprintf(buffer, "%u", {name});\n'
@@ -373,6 +425,8 @@ class EnumType(TypeInfo):
     def encode_func(self):
         return f'encode_enum<{self.cpp_type}>'
 
+    size_func = 'add_enum_field'
+
     def dump(self, name):
         o = f'out.append(proto_enum_to_string<{self.cpp_type}>({name}));'
         return o
@@ -384,6 +438,10 @@ class SFixed32Type(TypeInfo):
     default_value = '0'
     decode_32bit = 'value.as_sfixed32()'
     encode_func = 'encode_sfixed32'
+    size_func = 'add_fixed32_field'
+
+    def get_size_calculation(self, name, force=False):
+        return super().get_size_calculation(f'{name} != 0', force)
 
     def dump(self, name):
         o = f'sprintf(buffer, "%d", {name});\n'
@@ -397,9 +455,13 @@ class SFixed64Type(TypeInfo):
     default_value = '0'
     decode_64bit = 'value.as_sfixed64()'
     encode_func = 'encode_sfixed64'
+    size_func = 'add_fixed64_field'
+
+    def get_size_calculation(self, name, force=False):
+        return super().get_size_calculation(f'{name} != 0', force)
 
     def dump(self, name):
-        o = f'sprintf(buffer, "%ll", {name});\n'
+        o = f'sprintf(buffer, "%lld", {name});\n'
         o += f'out.append(buffer);'
         return o
 
@@ -410,6 +472,7 @@ class SInt32Type(TypeInfo):
     default_value = '0'
     decode_varint = 'value.as_sint32()'
     encode_func = 'encode_sint32'
+    size_func = 'add_sint32_field'
 
     def dump(self, name):
         o = f'sprintf(buffer, "%d", {name});\n'
@@ -422,10 +485,11 @@ class SInt64Type(TypeInfo):
     cpp_type = 'int64_t'
     default_value = '0'
     decode_varint = 'value.as_sint64()'
-    encode_func = 'encode_sin64'
+    encode_func = 'encode_sint64'
+    size_func = 'add_sint64_field'
 
-    def dump(self):
-        o = f'sprintf(buffer, "%ll", {name});\n'
+    def dump(self, name):
+        o = f'sprintf(buffer, "%lld", {name});\n'
         o += f'out.append(buffer);'
         return o
 
@@ -503,6 +567,13 @@ class RepeatedTypeInfo(TypeInfo):
           buffer.{self._ti.encode_func}({self.number}, it, true);
         }}"""
 
+    @property
+    def size_content(self):
+        o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
+        o += indent(self._ti.get_size_calculation('it', True)) + '\n'
+        o += f'}}'
+        return o
+
     @property
     def dump_content(self):
         o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
@@ -540,6 +611,7 @@ def build_message_type(desc):
     decode_32bit = []
     decode_64bit = []
     encode = []
+    size = []
     dump = []
 
     for field in desc.field:
@@ -550,6 +622,7 @@ def build_message_type(desc):
         protected_content.extend(ti.protected_content)
         public_content.extend(ti.public_content)
         encode.append(ti.encode_content)
+        size.append(ti.size_content)
 
         if ti.decode_varint_content:
             decode_varint.append(ti.decode_varint_content)
@@ -611,6 +684,14 @@ def build_message_type(desc):
     prot = 'void encode(ProtoWriteBuffer buffer) const override;'
     public_content.append(prot)
 
+    o = f"void {desc.name}::calculate_size(uint32_t &total_size) const {{\n"
+    if size:
+        o += indent('\n'.join(size)) + '\n'
+    o += '}\n'
+    cpp += o
+    prot = 'void calculate_size(uint32_t &total_size) const override;'
+    public_content.append(prot)
+
     o = f"void {desc.name}::dump_to(std::string &out) const {{\n"
     if dump:
         o += f"  char buffer[64];\n"
@@ -0,0 +1,85 @@
+import struct
+
+import pytest
+
+from esphome import binary_log
+from esphome.api.api_pb2 import BinaryLogResponse
+
+
+def _args(*values):
+    ret = b''
+    for fmt, value in values:
+        if fmt == 's':
+            ret += value.encode() + b'\0'
+        else:
+            ret += struct.pack('<' + fmt, value)
+    return ret
+
+
+@pytest.mark.parametrize("fmt, args, expected", (
+    ("plain text", b'', "plain text"),
+    ("100%%", b'', "100%"),
+    ("%d %i", _args(('i', -5), ('i', 7)), "-5 7"),
+    ("%u %05u %x %X %o", _args(('I', 4000000000), ('I', 42), ('I', 255), ('I', 255), ('I', 8)),
+     "4000000000 00042 ff FF 10"),
+    ("%lld %llu", _args(('q', -1), ('Q', 2**40)), "-1 1099511627776"),
+    ("%.2f %e", _args(('d', 3.14159), ('d', 1000.0)), "3.14 1.000000e+03"),
+    ("'%s' '%-4s'", _args(('s', "foo"), ('s', "ab")), "'foo' 'ab  '"),
+    ("%c", _args(('I', 0x41)), "A"),
+    ("%hd %hhu", _args(('i', 0x1FFFF), ('I', 0x1FF)), "-1 255"),
+    ("%*d|%.*f", _args(('i', 4), ('i', 7), ('i', 1), ('d', 2.25)), "   7|2.2"),
+    ("%p", _args(('I', 0x3FFB0000)), "0x3ffb0000"),
+    ("a=%d b=%d", _args(('i', 1)), "a=1 b=<truncated>"),
+))
+def test_format_message(fmt, args, expected):
+    actual = binary_log.format_message(fmt, args)
+
+    assert actual == expected
+
+
+def _elf(sections):
+    """Build a minimal 32-bit little endian ELF file with the given (address, content) sections."""
+    header_size = 52
+    data = b''
+    headers = [struct.pack('<10I', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)]
+    offset = header_size
+    for addr, content in sections:
+        headers.append(struct.pack('<10I', 0, 1, binary_log.SHF_ALLOC, addr, offset, len(content),
+                                   0, 0, 1, 0))
+        data += content
+        offset += len(content)
+    ident = b'\x7fELF' + bytes([1, 1, 1]) + bytes(9)
+    header = ident + struct.pack('<HHIIIIIHHHHHH', 2, 94, 1, 0, 0, offset, 0, header_size, 0, 0,
+                                 40, len(headers), 0)
+    return header + data + b''.join(headers)
+
+
+def test_firmware_image_read_string():
+    image = binary_log.FirmwareImage(_elf([(0x3FF00000, b'sensor\0Got %d\0'),
+                                           (0x40200000, b'flash string\0')]))
+
+    assert image.read_string(0x3FF00000) == "sensor"
+    assert image.read_string(0x3FF00007) == "Got %d"
+    assert image.read_string(0x40200006) == "string"
+    assert image.read_string(0x50000000) is None
+    assert image.contains(b'flash')
+
+
+def test_firmware_image_rejects_other_files():
+    with pytest.raises(ValueError):
+        binary_log.FirmwareImage(b'not an elf file')
+
+
+def test_decode_binary_log_response():
+    image = binary_log.FirmwareImage(_elf([(0x3FF00000, b'sensor\0Got %d\n\0')]))
+    decoder = binary_log.BinaryLogDecoder(image)
+    # level=5 (DEBUG), tag, line=42, format, args
+    raw = (b'\x08\x05' + b'\x15' + struct.pack('<I', 0x3FF00000) + b'\x18\x2a' +
+           b'\x25' + struct.pack('<I', 0x3FF00007) + b'\x2a\x04' + struct.pack('<i', 12))
+
+    msg = BinaryLogResponse.FromString(raw)
+    actual = decoder.decode(msg)
+
+    assert (msg.level, msg.tag, msg.line, msg.format) == (5, 0x3FF00000, 42, 0x3FF00007)
+    assert msg.args == struct.pack('<i', 12)
+    assert actual == "\033[0;36m[D][sensor:042]: Got 12\033[0m"
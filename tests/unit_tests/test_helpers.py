@@ -20,6 +20,34 @@ def test_ensure_unique_string(preferred_string, current_strings, expected):
     assert actual == expected
 
 
+@pytest.mark.parametrize("data, expected", (
+    ("", 0x811C9DC5),
+    ("a", 0x050C5D7E),
+    ("foobar", 0x31F0B262),
+    (b"foobar", 0x31F0B262),
+))
+def test_fnv1_hash(data, expected):
+    actual = helpers.fnv1_hash(data)
+
+    assert actual == expected
+
+
+@pytest.mark.parametrize("name, expected", (
+    ("Living Room Temperature", "living_room_temperature"),
+    ("ESP-01 Uptime (s)", "esp-01_uptime_s"),
+    ("Temp. \u00c4u\u00dfen", "temp_uen"),
+    ("\u212a", ""),
+))
+def test_object_id(name, expected):
+    actual = helpers.object_id(name)
+
+    assert actual == expected
+
+
+def test_object_id_hash():
+    assert helpers.object_id_hash("Living Room") == helpers.fnv1_hash("living_room")
+
+
 @pytest.mark.parametrize("text, expected", (
     ("foo", "foo"),
     ("foo\nbar", "foo\nbar"),